@@ -0,0 +1,215 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+
+
+// CGL_path_finding_a_star_find_path on square grids with 20% random walls,
+// 4 connected with a manhattan heuristic, from one corner to the other. Each
+// size is searched with a node hash function, with only the equals function
+// (node lookups scan every node) and with a copy of the previous search which
+// scanned every node to count the open nodes and to pick the next one, and
+// closed open neighbours it did not improve so it can return longer paths. The
+// scanning versions are quadratic so they only run up to their size limits.
+//
+// usage : a_star_benchmark [queries = 4] [scan_limit = 512] [previous_limit = 64]
+
+static CGL_int grid_size = 0;
+static CGL_ubyte* grid = NULL;
+static CGL_path_finding_a_star_context* context = NULL;
+
+static double now_ms()
+{
+    return (double)CGL_utils_get_time_ns() * 1e-6;
+}
+
+static CGL_bool node_equals(void* user_data, CGL_path_finding_node* a, CGL_path_finding_node* b)
+{
+    (void)user_data;
+    return *(CGL_int*)a->data_ptr == *(CGL_int*)b->data_ptr;
+}
+
+static CGL_uint node_hash(void* user_data, CGL_path_finding_node* a)
+{
+    (void)user_data;
+    return (CGL_uint)*(CGL_int*)a->data_ptr;
+}
+
+static CGL_int goal = 0;
+
+static CGL_float heuristic(void* user_data, CGL_path_finding_node* a)
+{
+    (void)user_data;
+    CGL_int id = *(CGL_int*)a->data_ptr;
+    return (CGL_float)(abs(id % grid_size - goal % grid_size) + abs(id / grid_size - goal / grid_size));
+}
+
+static CGL_float cost(void* user_data, CGL_path_finding_node* a, CGL_path_finding_node* b)
+{
+    (void)user_data; (void)a; (void)b;
+    return 1.0f;
+}
+
+static CGL_int get_neighbours(void* user_data, CGL_path_finding_node* a, CGL_int* neighbours_out)
+{
+    (void)user_data;
+    static const CGL_int offsets[4][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+    CGL_int id = *(CGL_int*)a->data_ptr, x = id % grid_size, y = id / grid_size, count = 0;
+    for (CGL_int i = 0; i < 4; i++)
+    {
+        CGL_int nx = x + offsets[i][0], ny = y + offsets[i][1];
+        if (nx < 0 || ny < 0 || nx >= grid_size || ny >= grid_size || grid[ny * grid_size + nx]) continue;
+        CGL_int nid = ny * grid_size + nx;
+        CGL_path_finding_node node; CGL_path_finding_node_init(&node, &nid);
+        neighbours_out[count++] = CGL_path_finding_a_star_add_node(context, node, node_equals);
+    }
+    return count;
+}
+
+static CGL_int path_steps()
+{
+    CGL_int steps = 0;
+    CGL_path_finding_a_star_reorder_path(context);
+    while (CGL_path_finding_a_star_next_in_path(context, NULL)) steps++;
+    return steps - 1;
+}
+
+// the previous search, every iteration scans all nodes twice and every neighbour lookup scans them again
+typedef struct { CGL_int cell, parent; CGL_float g, f; CGL_bool open, active; } legacy_node;
+
+static CGL_int legacy_find(legacy_node* nodes, CGL_int max_nodes, CGL_int* count, CGL_int cell)
+{
+    for (CGL_int i = 0; i < max_nodes; i++) if (nodes[i].active && nodes[i].cell == cell) return i;
+    if (*count >= max_nodes) return -1;
+    nodes[*count].cell = cell; nodes[*count].active = CGL_TRUE; nodes[*count].open = CGL_FALSE;
+    return (*count)++;
+}
+
+static CGL_int legacy_find_path(legacy_node* nodes, CGL_int max_nodes, CGL_int start, CGL_int end)
+{
+    static const CGL_int offsets[4][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+    for (CGL_int i = 0; i < max_nodes; i++) { nodes[i].active = nodes[i].open = CGL_FALSE; nodes[i].parent = -1; nodes[i].g = nodes[i].f = 0.0f; }
+    CGL_int count = 0, first = legacy_find(nodes, max_nodes, &count, start);
+    nodes[first].open = CGL_TRUE;
+    for (CGL_int epochs = 0; epochs <= 100 * max_nodes; epochs++)
+    {
+        CGL_int open = 0, current = -1;
+        for (CGL_int i = 0; i < max_nodes; i++) if (nodes[i].active && nodes[i].open) open++;
+        if (open == 0) return -1;
+        for (CGL_int i = 0; i < max_nodes; i++) if (nodes[i].active && nodes[i].open && (current == -1 || nodes[i].f <= nodes[current].f)) current = i;
+        nodes[current].open = CGL_FALSE;
+        if (nodes[current].cell == end) { CGL_int steps = 0; while (current != first) { current = nodes[current].parent; steps++; } return steps; }
+        CGL_int old_count = count, x = nodes[current].cell % grid_size, y = nodes[current].cell / grid_size;
+        for (CGL_int i = 0; i < 4; i++)
+        {
+            CGL_int nx = x + offsets[i][0], ny = y + offsets[i][1];
+            if (nx < 0 || ny < 0 || nx >= grid_size || ny >= grid_size || grid[ny * grid_size + nx]) continue;
+            CGL_int n = legacy_find(nodes, max_nodes, &count, ny * grid_size + nx);
+            if (n == -1) continue;
+            CGL_float g = nodes[current].g + 1.0f;
+            nodes[n].open = CGL_FALSE;
+            if (n >= old_count) { nodes[n].g = g; nodes[n].f = g + (CGL_float)(abs(nx - goal % grid_size) + abs(ny - goal / grid_size)); nodes[n].open = CGL_TRUE; nodes[n].parent = current; }
+            else if (g <= nodes[n].g) { nodes[n].f += g - nodes[n].g; nodes[n].g = g; nodes[n].parent = current; nodes[n].open = CGL_TRUE; }
+        }
+    }
+    return -1;
+}
+
+int main(int argc, char** argv)
+{
+    CGL_init();
+    CGL_int queries = argc > 1 ? atoi(argv[1]) : 4;
+    CGL_int scan_limit = argc > 2 ? atoi(argv[2]) : 512;
+    CGL_int previous_limit = argc > 3 ? atoi(argv[3]) : 64;
+    CGL_int sizes[] = { 64, 128, 512, 2048 };
+    printf("%d queries per size, average time per query\n", queries);
+    printf("%6s %8s %15s %15s %15s %15s\n", "size", "steps", "hash", "equals scan", "previous", "previous steps");
+    for (CGL_int s = 0; s < (CGL_int)CGL_utils_array_size(sizes); s++)
+    {
+        grid_size = sizes[s];
+        CGL_int cells = grid_size * grid_size;
+        grid = (CGL_ubyte*)malloc(cells);
+        context = CGL_path_finding_a_star_context_create(cells, CGL_TRUE, sizeof(CGL_int));
+        legacy_node* legacy_nodes = grid_size <= previous_limit ? (legacy_node*)malloc(sizeof(legacy_node) * cells) : NULL;
+        if (!grid || !context || (grid_size <= previous_limit && !legacy_nodes)) { printf("out of memory\n"); return 1; }
+        CGL_int start = 0; goal = cells - 1;
+        CGL_path_finding_node start_node; CGL_path_finding_node_init(&start_node, &start);
+        CGL_path_finding_node end_node; CGL_path_finding_node_init(&end_node, &goal);
+        CGL_path_finding_a_star_set_hash_function(context, node_hash);
+        for (CGL_int seed = 1; ; seed++) // walls can cut the corners off, retry until there is a path
+        {
+            srand(seed);
+            for (CGL_int i = 0; i < cells; i++) grid[i] = rand() % 100 < 20;
+            grid[start] = grid[goal] = 0;
+            if (CGL_path_finding_a_star_find_path(context, start_node, end_node, heuristic, cost, get_neighbours, node_equals, NULL)) break;
+        }
+
+        CGL_int steps = -1, previous_steps = -1;
+        double begin = now_ms();
+        for (CGL_int q = 0; q < queries; q++) if (CGL_path_finding_a_star_find_path(context, start_node, end_node, heuristic, cost, get_neighbours, node_equals, NULL)) steps = path_steps();
+        double hashed = (now_ms() - begin) / queries;
+
+        char scanned[32] = "-", previous[32] = "-", previous_steps_text[32] = "-";
+        if (grid_size <= scan_limit)
+        {
+            CGL_path_finding_a_star_set_hash_function(context, NULL);
+            begin = now_ms();
+            for (CGL_int q = 0; q < queries; q++) if (CGL_path_finding_a_star_find_path(context, start_node, end_node, heuristic, cost, get_neighbours, node_equals, NULL) && path_steps() != steps) printf("equals scan path differs\n");
+            snprintf(scanned, sizeof(scanned), "%.3f ms", (now_ms() - begin) / queries);
+        }
+        if (grid_size <= previous_limit)
+        {
+            begin = now_ms();
+            for (CGL_int q = 0; q < queries; q++) previous_steps = legacy_find_path(legacy_nodes, cells, start, goal);
+            snprintf(previous, sizeof(previous), "%.3f ms", (now_ms() - begin) / queries);
+            snprintf(previous_steps_text, sizeof(previous_steps_text), "%d", previous_steps);
+        }
+
+        printf("%6d %8d %12.3f ms %15s %15s %15s\n", grid_size, steps, hashed, scanned, previous, previous_steps_text);
+        CGL_path_finding_a_star_context_destroy(context);
+        free(grid); free(legacy_nodes);
+    }
+    CGL_shutdown();
+    return 0;
+}
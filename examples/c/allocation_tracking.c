@@ -0,0 +1,109 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_TRACK_ALLOCATIONS
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+
+// Builds a few library containers on the thread pool and on the main thread
+// with CGL_TRACK_ALLOCATIONS on, prints the live/peak bytes and allocation
+// rate of every subsystem, then leaves some objects alive so CGL_shutdown
+// reports them with their call sites.
+//
+// usage : allocation_tracking [items = 100000] [leak = 1]
+
+static void print_stats(const char* title)
+{
+    CGL_allocation_stats totals, subsystems[CGL_ALLOCATION_TRACKER_MAX_SUBSYSTEMS];
+    CGL_allocation_tracker_get_stats(&totals);
+    CGL_sizei count = CGL_allocation_tracker_get_subsystem_stats(subsystems, CGL_ALLOCATION_TRACKER_MAX_SUBSYSTEMS);
+    printf("\n%s\n", title);
+    printf("%-12s %12s %8s %12s %10s %10s %14s\n", "subsystem", "live bytes", "live", "peak bytes", "allocs", "frees", "allocs/s");
+    for (CGL_sizei i = 0; i < count; i++)
+    {
+        CGL_allocation_stats* s = &subsystems[i];
+        printf("%-12s %12zu %8zu %12zu %10zu %10zu %14.0f\n", s->subsystem, s->live_bytes, s->live_count, s->peak_live_bytes, s->allocation_count, s->free_count, s->allocations_per_second);
+    }
+    printf("%-12s %12zu %8zu %12zu %10zu %10zu %14.0f\n", "total", totals.live_bytes, totals.live_count, totals.peak_live_bytes, totals.allocation_count, totals.free_count, totals.allocations_per_second);
+}
+
+static void fill_lists(CGL_sizei begin, CGL_sizei end, CGL_void* user_data)
+{
+    (void)user_data;
+    for (CGL_sizei i = begin; i < end; i++)
+    {
+        CGL_list* list = CGL_list_create(sizeof(CGL_int), 1);
+        for (CGL_int j = 0; j < 32; j++) CGL_list_push(list, &j);
+        CGL_list_destroy(list);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int items = argc > 1 ? atoi(argv[1]) : 100000;
+    int leak = argc > 2 ? atoi(argv[2]) : 1;
+
+    CGL_init();
+
+    CGL_hashtable* table = CGL_hashtable_create(16, sizeof(CGL_int), 0);
+    for (CGL_int i = 0; i < items; i++) CGL_hashtable_set(table, &i, &i, sizeof(CGL_int));
+    CGL_matrix* a = CGL_matrix_create(256, 256);
+    CGL_matrix* b = CGL_matrix_create(256, 256);
+    CGL_matrix* c = CGL_matrix_mul(a, b);
+    CGL_parallel_for(0, items / 10, 64, fill_lists, NULL);
+    print_stats("after building");
+
+    CGL_hashtable_destroy(table);
+    CGL_matrix_destroy(c);
+    CGL_allocation_tracker_reset_peak();
+    print_stats("after releasing the hashtable and the product (peaks reset)");
+
+    if (!leak)
+    {
+        CGL_matrix_destroy(a);
+        CGL_matrix_destroy(b);
+    }
+    printf("\n");
+    CGL_shutdown(); // dumps whatever is still alive to stderr
+    return 0;
+}
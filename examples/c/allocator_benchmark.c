@@ -0,0 +1,202 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+// Allocation throughput of CGL_arena and CGL_pool_allocator against libc, and
+// the libc allocation count / frame time of a "frame" of temporary work (a
+// list, a string keyed hashtable and a few small matrices, all thrown away at
+// the end) built with the default allocator versus a frame arena that is
+// reset in O(1).
+//
+// usage : allocator_benchmark [allocations_per_frame = 10000] [frames = 200]
+
+static uint64_t libc_allocations;
+
+static CGL_void* counting_allocate(CGL_void* user_data, CGL_sizei size)
+{
+    (void)user_data;
+    libc_allocations++;
+    return malloc(size);
+}
+
+static CGL_void* counting_reallocate(CGL_void* user_data, CGL_void* ptr, CGL_sizei old_size, CGL_sizei new_size)
+{
+    (void)user_data; (void)old_size;
+    libc_allocations++;
+    return realloc(ptr, new_size);
+}
+
+static CGL_void counting_deallocate(CGL_void* user_data, CGL_void* ptr, CGL_sizei size)
+{
+    (void)user_data; (void)size;
+    free(ptr);
+}
+
+static void* pointers[1 << 20];
+static CGL_sizei sizes[1 << 20];
+
+// nanoseconds per allocation + free of the given sizes
+static double bench_libc(int count, int frames)
+{
+    uint64_t start = CGL_utils_get_time_ns();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        for (int i = 0; i < count; i++) { pointers[i] = malloc(sizes[i]); *(char*)pointers[i] = (char)i; }
+        for (int i = 0; i < count; i++) free(pointers[i]);
+    }
+    return (double)(CGL_utils_get_time_ns() - start) / ((double)count * frames);
+}
+
+static double bench_arena(CGL_arena* arena, int count, int frames)
+{
+    uint64_t start = CGL_utils_get_time_ns();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        for (int i = 0; i < count; i++) { pointers[i] = CGL_arena_alloc(arena, sizes[i]); *(char*)pointers[i] = (char)i; }
+        CGL_arena_reset(arena);
+    }
+    return (double)(CGL_utils_get_time_ns() - start) / ((double)count * frames);
+}
+
+static double bench_libc_fixed(int count, int frames, CGL_sizei size)
+{
+    uint64_t start = CGL_utils_get_time_ns();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        for (int i = 0; i < count; i++) { pointers[i] = malloc(size); *(char*)pointers[i] = (char)i; }
+        // free every other item first so the free lists get fragmented like in real use
+        for (int i = 0; i < count; i += 2) free(pointers[i]);
+        for (int i = 1; i < count; i += 2) free(pointers[i]);
+    }
+    return (double)(CGL_utils_get_time_ns() - start) / ((double)count * frames);
+}
+
+static double bench_pool(CGL_pool_allocator* pool, int count, int frames)
+{
+    uint64_t start = CGL_utils_get_time_ns();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        for (int i = 0; i < count; i++) { pointers[i] = CGL_pool_allocator_alloc(pool); *(char*)pointers[i] = (char)i; }
+        for (int i = 0; i < count; i += 2) CGL_pool_allocator_free(pool, pointers[i]);
+        for (int i = 1; i < count; i += 2) CGL_pool_allocator_free(pool, pointers[i]);
+    }
+    return (double)(CGL_utils_get_time_ns() - start) / ((double)count * frames);
+}
+
+// one frame of temporary work, every container is created with the given allocator, with an arena
+// the containers do not have to be destroyed one by one as the reset takes everything back at once
+static void frame_work(const CGL_allocator* allocator, int count, bool destroy)
+{
+    char key[32];
+    CGL_list* list = CGL_list_create_ex(sizeof(CGL_vec3), 16, allocator);
+    CGL_hashtable* table = CGL_hashtable_create_ex(64, 0, 64, allocator);
+    for (int i = 0; i < count; i++)
+    {
+        CGL_vec3 v = CGL_vec3_init((CGL_float)i, 0.0f, 0.0f);
+        CGL_list_push(list, &v);
+        if (i % 4 == 0)
+        {
+            snprintf(key, sizeof(key), "entity_%d", i);
+            CGL_hashtable_set(table, key, &v, sizeof(v));
+        }
+        if (i % 64 == 0)
+        {
+            CGL_matrix* m = CGL_matrix_create_ex(4, 4, allocator);
+            CGL_matrix_identity_to(4, 4, m);
+            CGL_matrix_destroy(m);
+        }
+    }
+    if (!destroy) return;
+    CGL_hashtable_destroy(table);
+    CGL_list_destroy(list);
+}
+
+int main(int argc, char** argv)
+{
+    int count = argc > 1 ? atoi(argv[1]) : 10000;
+    int frames = argc > 2 ? atoi(argv[2]) : 200;
+    count = CGL_utils_min(count, 1 << 20);
+
+    if (!CGL_init()) return 1;
+    srand(42);
+    for (int i = 0; i < count; i++) sizes[i] = 16 + (CGL_sizei)(rand() % 241);
+
+    CGL_arena* arena = CGL_arena_create(1024 * 1024);
+    CGL_pool_allocator* pool = CGL_pool_allocator_create(64, 4096);
+
+    printf("raw allocations (%d per frame, ns per allocation including its release)\n", count);
+    printf("  %-36s%10.2f\n", "malloc / free, 16..256 bytes", bench_libc(count, frames));
+    printf("  %-36s%10.2f\n", "CGL_arena + reset, 16..256 bytes", bench_arena(arena, count, frames));
+    printf("  %-36s%10.2f\n", "malloc / free, 64 bytes", bench_libc_fixed(count, frames, 64));
+    printf("  %-36s%10.2f\n", "CGL_pool_allocator, 64 bytes", bench_pool(pool, count, frames));
+
+    CGL_allocator counting = { counting_allocate, counting_reallocate, counting_deallocate, NULL };
+    CGL_allocator frame_allocator = CGL_arena_get_allocator(arena);
+
+    printf("\nframe of temporary containers (%d list items, %d hashtable entries, %d matrices)\n", count, (count + 3) / 4, (count + 63) / 64);
+    printf("  %-36s%16s%16s\n", "", "us per frame", "libc allocs");
+    libc_allocations = 0;
+    uint64_t start = CGL_utils_get_time_ns();
+    for (int frame = 0; frame < frames; frame++) frame_work(&counting, count, true);
+    double default_time = (double)(CGL_utils_get_time_ns() - start) / frames / 1000.0;
+    printf("  %-36s%16.2f%16.1f\n", "default allocator", default_time, (double)libc_allocations / frames);
+
+    for (int destroy = 1; destroy >= 0; destroy--)
+    {
+        start = CGL_utils_get_time_ns();
+        for (int frame = 0; frame < frames; frame++)
+        {
+            frame_work(&frame_allocator, count, destroy);
+            CGL_arena_reset(arena);
+        }
+        double arena_time = (double)(CGL_utils_get_time_ns() - start) / frames / 1000.0;
+        printf("  %-36s%16.2f%16.1f\n", destroy ? "frame arena" : "frame arena, reset only", arena_time, 0.0);
+    }
+    printf("  arena capacity after warm up : %zu bytes\n", CGL_arena_get_capacity(arena));
+
+    CGL_pool_allocator_destroy(pool);
+    CGL_arena_destroy(arena);
+    CGL_shutdown();
+    return 0;
+}
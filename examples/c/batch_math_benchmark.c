@@ -0,0 +1,174 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+
+
+// Throughput of the batch math kernels against the same work done one element
+// at a time with the per vector macros and functions (CGL_vec3_normalize,
+// CGL_mat4_mul_vec4, CGL_mat4_mul, ...), in millions of elements per second.
+// Build with -mavx2 -mfma to get the avx2 kernels and with
+// -DCGL_MATH_BATCH_NO_SIMD to see the scalar fallback.
+//
+// usage : batch_math_benchmark [count = 4096] [iterations = 2000]
+
+static double now_ms()
+{
+    return (double)CGL_utils_get_time_ns() * 1e-6;
+}
+
+static CGL_float random_float()
+{
+    return (CGL_float)rand() / (CGL_float)RAND_MAX * 2.0f - 1.0f;
+}
+
+static void report(const char* name, size_t elements, double batch_ms, double scalar_ms)
+{
+    printf("%-30s %10.1f %10.1f %8.2fx\n", name, (double)elements / (batch_ms * 1e3), (double)elements / (scalar_ms * 1e3), scalar_ms / batch_ms);
+}
+
+int main(int argc, char** argv)
+{
+    size_t count = argc > 1 ? (size_t)atoll(argv[1]) : 4096;
+    int iterations = argc > 2 ? atoi(argv[2]) : 2000;
+    // every output buffer is read back for the checksum, so each kernel has to run at least once
+    count = CGL_utils_max(count, 1);
+    iterations = CGL_utils_max(iterations, 1);
+    size_t elements = count * (size_t)iterations;
+    CGL_vec3* a3 = (CGL_vec3*)malloc(count * sizeof(CGL_vec3));
+    CGL_vec3* b3 = (CGL_vec3*)malloc(count * sizeof(CGL_vec3));
+    CGL_vec3* out3 = (CGL_vec3*)malloc(count * sizeof(CGL_vec3));
+    CGL_vec4* a4 = (CGL_vec4*)malloc(count * sizeof(CGL_vec4));
+    CGL_vec4* out4 = (CGL_vec4*)malloc(count * sizeof(CGL_vec4));
+    CGL_float* soa = (CGL_float*)malloc(count * 6 * sizeof(CGL_float));
+    CGL_float* dots = (CGL_float*)malloc(count * sizeof(CGL_float));
+    CGL_mat4* ma = (CGL_mat4*)malloc(count * sizeof(CGL_mat4));
+    CGL_mat4* mb = (CGL_mat4*)malloc(count * sizeof(CGL_mat4));
+    CGL_mat4* mo = (CGL_mat4*)malloc(count * sizeof(CGL_mat4));
+    if (!a3 || !b3 || !out3 || !a4 || !out4 || !soa || !dots || !ma || !mb || !mo) { printf("out of memory\n"); return 1; }
+    for (size_t i = 0; i < count; i++)
+    {
+        a3[i] = CGL_vec3_init(random_float(), random_float(), random_float());
+        b3[i] = CGL_vec3_init(random_float(), random_float(), random_float());
+        a4[i] = CGL_vec4_init(a3[i].x, a3[i].y, a3[i].z, 1.0f);
+        soa[i] = a3[i].x; soa[count + i] = a3[i].y; soa[count * 2 + i] = a3[i].z;
+        for (int k = 0; k < 16; k++) { ma[i].m[k] = random_float(); mb[i].m[k] = random_float(); }
+    }
+    CGL_mat4 m = ma[0];
+    CGL_vec3_soa points = CGL_vec3_soa_init(soa, soa + count, soa + count * 2);
+    CGL_vec3_soa transformed = CGL_vec3_soa_init(soa + count * 3, soa + count * 4, soa + count * 5);
+    CGL_float checksum = 0.0f;
+    double start, batch_ms, scalar_ms;
+    printf("%zu elements x %d iterations\n", count, iterations);
+    printf("%-30s %10s %10s %9s\n", "kernel", "batch M/s", "scalar M/s", "speedup");
+
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) CGL_vec3_array_add(a3, b3, out3, count);
+    batch_ms = now_ms() - start; checksum += out3[count / 2].x;
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) for (size_t i = 0; i < count; i++) out3[i] = CGL_vec3_add(a3[i], b3[i]);
+    scalar_ms = now_ms() - start; checksum += out3[count / 2].x;
+    report("CGL_vec3_array_add", elements, batch_ms, scalar_ms);
+
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) CGL_vec3_array_dot(a3, b3, dots, count);
+    batch_ms = now_ms() - start; checksum += dots[count / 2];
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) for (size_t i = 0; i < count; i++) dots[i] = CGL_vec3_dot(a3[i], b3[i]);
+    scalar_ms = now_ms() - start; checksum += dots[count / 2];
+    report("CGL_vec3_array_dot", elements, batch_ms, scalar_ms);
+
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) CGL_vec3_array_normalize(a3, out3, count);
+    batch_ms = now_ms() - start; checksum += out3[count / 2].y;
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) for (size_t i = 0; i < count; i++) { CGL_vec3 v = a3[i]; CGL_vec3_normalize(v); out3[i] = v; }
+    scalar_ms = now_ms() - start; checksum += out3[count / 2].y;
+    report("CGL_vec3_array_normalize", elements, batch_ms, scalar_ms);
+
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) CGL_vec3_soa_normalize(points, transformed, count);
+    batch_ms = now_ms() - start; checksum += transformed.y[count / 2];
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) for (size_t i = 0; i < count; i++) { CGL_vec3 v = CGL_vec3_init(points.x[i], points.y[i], points.z[i]); CGL_vec3_normalize(v); transformed.x[i] = v.x; transformed.y[i] = v.y; transformed.z[i] = v.z; }
+    scalar_ms = now_ms() - start; checksum += transformed.y[count / 2];
+    report("CGL_vec3_soa_normalize", elements, batch_ms, scalar_ms);
+
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) CGL_mat4_transform_points(m, a3, out3, count);
+    batch_ms = now_ms() - start; checksum += out3[count / 2].z;
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) for (size_t i = 0; i < count; i++) { CGL_vec4 v = CGL_mat4_mul_vec4(m, CGL_vec4_init(a3[i].x, a3[i].y, a3[i].z, 1.0f)); out3[i] = CGL_vec3_init(v.x, v.y, v.z); }
+    scalar_ms = now_ms() - start; checksum += out3[count / 2].z;
+    report("CGL_mat4_transform_points", elements, batch_ms, scalar_ms);
+
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) CGL_mat4_transform_points_soa(m, points, transformed, count);
+    batch_ms = now_ms() - start; checksum += transformed.z[count / 2];
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) for (size_t i = 0; i < count; i++) { CGL_vec4 v = CGL_mat4_mul_vec4(m, CGL_vec4_init(points.x[i], points.y[i], points.z[i], 1.0f)); transformed.x[i] = v.x; transformed.y[i] = v.y; transformed.z[i] = v.z; }
+    scalar_ms = now_ms() - start; checksum += transformed.z[count / 2];
+    report("..._transform_points_soa", elements, batch_ms, scalar_ms);
+
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) CGL_mat4_transform_vec4_array(m, a4, out4, count);
+    batch_ms = now_ms() - start; checksum += out4[count / 2].w;
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) for (size_t i = 0; i < count; i++) out4[i] = CGL_mat4_mul_vec4(m, a4[i]);
+    scalar_ms = now_ms() - start; checksum += out4[count / 2].w;
+    report("CGL_mat4_transform_vec4_array", elements, batch_ms, scalar_ms);
+
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) CGL_mat4_mul_batch(ma, mb, mo, count);
+    batch_ms = now_ms() - start; checksum += mo[count / 2].m[5];
+    start = now_ms();
+    for (int it = 0; it < iterations; it++) for (size_t i = 0; i < count; i++) mo[i] = CGL_mat4_mul(ma[i], mb[i]);
+    scalar_ms = now_ms() - start; checksum += mo[count / 2].m[5];
+    report("CGL_mat4_mul_batch", elements, batch_ms, scalar_ms);
+
+    printf("checksum %f\n", checksum);
+    free(a3); free(b3); free(out3); free(a4); free(out4); free(soa); free(dots); free(ma); free(mb); free(mo);
+    CGL_shutdown();
+    return 0;
+}
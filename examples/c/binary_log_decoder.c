@@ -0,0 +1,63 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+// Turns a binary log written through CGL_logger_attach_binary_log_file back
+// into the usual text log format.
+//
+// usage : binary_log_decoder <binary log> [text log (stdout if not given)]
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        printf("usage : %s <binary log> [text log]\n", argv[0]);
+        return 1;
+    }
+    if (!CGL_logger_decode_binary_log(argv[1], argc > 2 ? argv[2] : NULL))
+    {
+        fprintf(stderr, "failed to decode %s (missing, truncated or not a binary log)\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,142 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+// Scaling benchmark for CGL_concurrent_hashtable. Every thread inserts and then
+// looks up its own range of keys in one shared table. The same work is also run
+// on a plain CGL_hashtable behind a single global CGL_mutex for comparison.
+// Finally a single thread fills tables with only a few shards so that every
+// shard grows far past 65536 buckets, this catches shard and bucket indices
+// that are taken from correlated hash bits.
+//
+// usage : concurrent_hashtable_benchmark [max_threads = 8] [keys_per_thread = 250000] [large_key_count = 400000]
+
+#define MAX_THREADS 64
+
+typedef struct
+{
+    CGL_concurrent_hashtable* concurrent_table;
+    CGL_hashtable* table;
+    CGL_mutex* mutex;
+    uint64_t first_key;
+    uint64_t key_count;
+} worker_data;
+
+#ifdef CGL_WINDOWS
+static void worker_function(void* argument)
+#else
+static void* worker_function(void* argument)
+#endif
+{
+    worker_data* data = (worker_data*)argument;
+    uint64_t value = 0;
+    for (uint64_t key = data->first_key; key < data->first_key + data->key_count; key++)
+    {
+        if (data->concurrent_table) CGL_concurrent_hashtable_set(data->concurrent_table, &key, &key, sizeof(key));
+        else { CGL_mutex_lock(data->mutex, 0); CGL_hashtable_set(data->table, &key, &key, sizeof(key)); CGL_mutex_release(data->mutex); }
+    }
+    for (uint64_t key = data->first_key; key < data->first_key + data->key_count; key++)
+    {
+        if (data->concurrent_table) CGL_concurrent_hashtable_get(data->concurrent_table, &key, &value);
+        else { CGL_mutex_lock(data->mutex, 0); CGL_hashtable_get(data->table, &key, &value); CGL_mutex_release(data->mutex); }
+    }
+#ifndef CGL_WINDOWS
+    return NULL;
+#endif
+}
+
+static double run(int thread_count, uint64_t keys_per_thread, bool concurrent)
+{
+    static CGL_thread* threads[MAX_THREADS];
+    static worker_data data[MAX_THREADS];
+    CGL_concurrent_hashtable* concurrent_table = concurrent ? CGL_concurrent_hashtable_create(thread_count * 16, sizeof(uint64_t), 1024) : NULL;
+    CGL_hashtable* table = concurrent ? NULL : CGL_hashtable_create(1024, sizeof(uint64_t), 1024);
+    CGL_mutex* mutex = concurrent ? NULL : CGL_mutex_create(false);
+
+    uint64_t start = CGL_utils_get_time_ns();
+    for (int i = 0; i < thread_count; i++)
+    {
+        data[i].concurrent_table = concurrent_table;
+        data[i].table = table;
+        data[i].mutex = mutex;
+        data[i].first_key = (uint64_t)i * keys_per_thread;
+        data[i].key_count = keys_per_thread;
+        threads[i] = CGL_thread_create();
+        CGL_thread_start(threads[i], worker_function, &data[i]);
+    }
+    for (int i = 0; i < thread_count; i++) { CGL_thread_join(threads[i]); CGL_thread_destroy(threads[i]); }
+    double seconds = (CGL_utils_get_time_ns() - start) / 1e9;
+
+    if (concurrent_table) CGL_concurrent_hashtable_destroy(concurrent_table);
+    if (table) CGL_hashtable_destroy(table);
+    if (mutex) CGL_mutex_destroy(mutex);
+    return (double)(thread_count * keys_per_thread * 2) / seconds / 1e6;
+}
+
+static double run_large(size_t shard_count, uint64_t key_count)
+{
+    CGL_concurrent_hashtable* table = CGL_concurrent_hashtable_create(shard_count, sizeof(uint64_t), 1024);
+    uint64_t value = 0, found = 0;
+    uint64_t start = CGL_utils_get_time_ns();
+    for (uint64_t key = 0; key < key_count; key++) CGL_concurrent_hashtable_set(table, &key, &key, sizeof(key));
+    for (uint64_t key = 0; key < key_count; key++) found += CGL_concurrent_hashtable_get(table, &key, &value) ? 1 : 0;
+    double seconds = (CGL_utils_get_time_ns() - start) / 1e9;
+    CGL_concurrent_hashtable_destroy(table);
+    if (found != key_count) printf("error : only found %llu of %llu keys\n", (unsigned long long)found, (unsigned long long)key_count);
+    return (double)(key_count * 2) / seconds / 1e6;
+}
+
+int main(int argc, char** argv)
+{
+    int max_threads = argc > 1 ? atoi(argv[1]) : 8;
+    uint64_t keys_per_thread = argc > 2 ? (uint64_t)atoll(argv[2]) : 250000;
+    uint64_t large_key_count = argc > 3 ? (uint64_t)atoll(argv[3]) : 400000;
+    max_threads = CGL_utils_clamp(max_threads, 1, MAX_THREADS);
+    printf("threads | sharded (Mops/s) | global mutex (Mops/s)\n");
+    for (int thread_count = 1; thread_count <= max_threads; thread_count *= 2)
+        printf("%7d | %16.2f | %21.2f\n", thread_count, run(thread_count, keys_per_thread, true), run(thread_count, keys_per_thread, false));
+    printf("\nlarge tables, %llu keys on one thread\n", (unsigned long long)large_key_count);
+    printf("shards | Mops/s\n");
+    for (size_t shard_count = 1; shard_count <= 4; shard_count *= 2)
+        printf("%6zu | %6.2f\n", shard_count, run_large(shard_count, large_key_count));
+    return 0;
+}
@@ -0,0 +1,131 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+
+
+// Throughput of CGL_csv_reader in MB/s on a generated file with an int, two
+// float and a quoted string column (with "" escapes): parsing a buffer in
+// memory with typed column conversion, loading the mapped file and streaming
+// it row by row with CGL_csv_stream_file while summing a column. The old
+// CGL_csv_load_from_buffer copies every field into fixed size items, it only
+// gets the first few megabytes.
+//
+// usage : csv_reader_benchmark [megabytes = 64]
+
+static double now_ms()
+{
+    return (double)CGL_utils_get_time_ns() * 1e-6;
+}
+
+static CGL_bool sum_row(const CGL_csv_row* row, CGL_void* user_data)
+{
+    CGL_double value = 0.0;
+    if (row->index > 0 && CGL_csv_parse_float(row->data + row->fields[1].offset, row->fields[1].length, &value)) *(CGL_double*)user_data += value;
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    CGL_init();
+    CGL_sizei megabytes = argc > 1 ? (CGL_sizei)atoi(argv[1]) : 64;
+    CGL_sizei capacity = megabytes << 20;
+    const char* path = "csv_reader_benchmark.csv";
+    CGL_byte* data = (CGL_byte*)malloc(capacity + 256);
+    if (!data) { printf("out of memory\n"); return 1; }
+    srand(42);
+    CGL_sizei size = (CGL_sizei)sprintf(data, "id,x,y,name\n");
+    for (CGL_int row = 0; size < capacity; row++)
+        size += (CGL_sizei)sprintf(data + size, "%d,%.4f,%.2f,\"item \"\"%d\"\"\"\n", row, (double)rand() / RAND_MAX * 1000.0, (double)(rand() % 100000) / 100.0, rand() % 10000);
+    FILE* file = fopen(path, "wb");
+    if (!file || fwrite(data, 1, size, file) != size) { printf("could not write %s\n", path); return 1; }
+    fclose(file);
+    double mb = (double)size / 1048576.0;
+    printf("%.1f MB, 4 columns\n", mb);
+    printf("%24s %12s %12s\n", "", "time", "throughput");
+
+    CGL_csv_reader* reader = CGL_csv_reader_create(',', true);
+    double start = now_ms();
+    CGL_bool parsed = CGL_csv_reader_parse(reader, data, size);
+    double elapsed = now_ms() - start;
+    if (!parsed) { printf("parse failed\n"); return 1; }
+    printf("%24s %9.1f ms %7.1f MB/s (%zu rows, column types %d %d %d %d)\n", "reader parse", elapsed, mb / elapsed * 1000.0, CGL_csv_reader_get_row_count(reader),
+        CGL_csv_reader_get_column_type(reader, 0), CGL_csv_reader_get_column_type(reader, 1), CGL_csv_reader_get_column_type(reader, 2), CGL_csv_reader_get_column_type(reader, 3));
+    CGL_double column_sum = 0.0;
+    const CGL_double* xs = CGL_csv_reader_get_floats(reader, 1);
+    for (CGL_sizei i = 0; i < CGL_csv_reader_get_row_count(reader); i++) column_sum += xs[i];
+
+    start = now_ms();
+    CGL_bool loaded = CGL_csv_reader_load(reader, path);
+    elapsed = now_ms() - start;
+    if (!loaded) { printf("load failed\n"); return 1; }
+    printf("%24s %9.1f ms %7.1f MB/s\n", "reader load (mapped)", elapsed, mb / elapsed * 1000.0);
+
+    CGL_double stream_sum = 0.0;
+    start = now_ms();
+    CGL_bool streamed = CGL_csv_stream_file(path, ',', sum_row, &stream_sum);
+    elapsed = now_ms() - start;
+    printf("%24s %9.1f ms %7.1f MB/s\n", "stream file", elapsed, mb / elapsed * 1000.0);
+    if (!streamed || fabs(stream_sum - column_sum) > 1e-6 * fabs(column_sum)) printf("stream sum %f differs from %f\n", stream_sum, column_sum);
+
+    // the old reader on the first 4 MB, cut at a line break
+    CGL_sizei old_size = CGL_utils_min(size, (CGL_sizei)4 << 20);
+    while (old_size > 0 && data[old_size - 1] != '\n') old_size--;
+    CGL_byte saved = data[old_size];
+    data[old_size] = '\0';
+    CGL_csv* csv = CGL_csv_create(32);
+    start = now_ms();
+    CGL_bool old_loaded = CGL_csv_load_from_buffer(csv, data, ",");
+    elapsed = now_ms() - start;
+    data[old_size] = saved;
+    printf("%24s %9.1f ms %7.1f MB/s (%.1f MB only)\n", "CGL_csv_load_from_buffer", elapsed, (double)old_size / 1048576.0 / elapsed * 1000.0, (double)old_size / 1048576.0);
+    if (!old_loaded) printf("CGL_csv_load_from_buffer failed\n");
+
+    CGL_csv_destroy(csv);
+    CGL_csv_reader_destroy(reader);
+    remove(path);
+    free(data);
+    CGL_shutdown();
+    return 0;
+}
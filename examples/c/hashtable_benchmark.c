@@ -0,0 +1,237 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+// Benchmarks CGL_hashtable insert/lookup/remove from 10^3 to 10^max_exponent entries
+// next to a copy of the previous chained table. Integer keys are pre-sized, string keys
+// start from a tiny table so that rehashing and storage growth are part of the measured
+// insert cost (the previous table never grew its buckets, so it stays at 16 chains).
+// Every insert into the previous table scans its storage for a free entry, so its
+// inserts are quadratic and only run up to 10^previous_max_exponent entries. Above
+// that the integer keys are appended without the scan, which gives the same table
+// since nothing was removed, so its lookups are still compared. Its string lookups
+// walk chains of count / 16 entries and are skipped above the limit as well.
+//
+// usage : hashtable_benchmark [max_exponent = 7] [previous_max_exponent = 5]
+
+// the previous table, every entry holds a fixed size key, buckets are chains through the storage and entry 0 ends them
+typedef struct { uint8_t key[CGL_HASHTABLE_MAX_KEY_SIZE]; uint8_t value_static[CGL_HASHTABLE_ENTRY_STATIC_VALUE_SIZE]; size_t value_size; size_t next_entry; size_t index; void* value; bool set; } legacy_entry;
+typedef struct { legacy_entry* storage; size_t* table; size_t capacity; size_t table_size; size_t key_size; size_t count; } legacy_table;
+
+// the storage is made big enough up front, growing it freed the new storage in the previous table
+static legacy_table* legacy_create(size_t table_size, size_t key_size, size_t capacity)
+{
+    legacy_table* table = (legacy_table*)calloc(1, sizeof(legacy_table));
+    if (!table) return NULL;
+    table->storage = (legacy_entry*)calloc(capacity + 1, sizeof(legacy_entry));
+    table->table = (size_t*)calloc(table_size, sizeof(size_t));
+    if (!table->storage || !table->table) { free(table->storage); free(table->table); free(table); return NULL; }
+    table->capacity = capacity + 1; table->table_size = table_size; table->key_size = key_size;
+    return table;
+}
+
+static void legacy_destroy(legacy_table* table)
+{
+    free(table->storage); free(table->table); free(table);
+}
+
+static size_t legacy_index(legacy_table* table, const void* key, size_t* key_size)
+{
+    *key_size = CGL_utils_clamp(table->key_size == 0 ? strlen((const char*)key) + 1 : table->key_size, 1, CGL_HASHTABLE_MAX_KEY_SIZE);
+    return CGL_utils_super_fast_hash(key, *key_size) % table->table_size;
+}
+
+static legacy_entry* legacy_find(legacy_table* table, const void* key)
+{
+    size_t key_size, index = legacy_index(table, key, &key_size);
+    if (table->table[index] == 0) return NULL;
+    for (legacy_entry* entry = &table->storage[table->table[index]]; entry->index != 0; entry = &table->storage[entry->next_entry])
+        if (memcmp(entry->key, key, key_size) == 0) return entry;
+    return NULL;
+}
+
+// values are at most CGL_HASHTABLE_ENTRY_STATIC_VALUE_SIZE bytes here, scan = false takes the next entry instead of searching for a free one
+static void legacy_set(legacy_table* table, const void* key, const void* value, size_t value_size, bool scan)
+{
+    size_t key_size, index = legacy_index(table, key, &key_size);
+    legacy_entry* entry = legacy_find(table, key);
+    if (!entry)
+    {
+        size_t id = 1;
+        if (scan) { while (id < table->capacity && table->storage[id].set) id++; }
+        else id = table->count + 1;
+        if (id >= table->capacity) return;
+        entry = &table->storage[id]; entry->index = id; entry->next_entry = 0;
+        if (table->table[index] == 0) table->table[index] = id;
+        else
+        {
+            legacy_entry* last = &table->storage[table->table[index]];
+            while (last->next_entry != 0) last = &table->storage[last->next_entry];
+            last->next_entry = id;
+        }
+        table->count++;
+    }
+    entry->set = true;
+    memcpy(entry->key, key, key_size);
+    entry->value_size = value_size;
+    memcpy(entry->value_static, value, value_size);
+}
+
+static size_t legacy_get(legacy_table* table, const void* key, void* value)
+{
+    legacy_entry* entry = legacy_find(table, key);
+    if (!entry) return 0;
+    memcpy(value, entry->value_static, entry->value_size);
+    return entry->value_size;
+}
+
+static double elapsed_ns_per_op(uint64_t start, CGL_sizei count)
+{
+    return (double)(CGL_utils_get_time_ns() - start) / (double)count;
+}
+
+static void format_time(char* text, double time)
+{
+    if (time < 0.0) sprintf(text, "-");
+    else sprintf(text, "%.1f ns", time);
+}
+
+static void print_row(const char* name, CGL_sizei count, double* times, uint64_t checksum)
+{
+    char text[7][32];
+    for (int i = 0; i < 7; i++) format_time(text[i], times[i]);
+    printf("%-4s %10zu | %11s %11s | %11s %11s | %11s %11s | %11s | (%llu)\n",
+        name, count, text[0], text[1], text[2], text[3], text[4], text[5], text[6], (unsigned long long)checksum);
+}
+
+static void benchmark_integer_keys(CGL_sizei count, CGL_sizei previous_limit)
+{
+    double times[7] = { -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0 }; // insert, lookup and miss for both tables, then remove
+    uint64_t start = 0, value = 0, checksum = 0;
+
+    CGL_hashtable* table = CGL_hashtable_create(count, sizeof(uint64_t), count);
+    start = CGL_utils_get_time_ns();
+    for (uint64_t i = 0; i < count; i++) { value = i * 7; CGL_hashtable_set(table, &i, &value, sizeof(value)); }
+    times[0] = elapsed_ns_per_op(start, count);
+
+    start = CGL_utils_get_time_ns();
+    for (uint64_t i = 0; i < count; i++) { CGL_hashtable_get(table, &i, &value); checksum += value; }
+    times[2] = elapsed_ns_per_op(start, count);
+
+    start = CGL_utils_get_time_ns();
+    for (uint64_t i = count; i < count * 2; i++) checksum += CGL_hashtable_exists(table, &i);
+    times[4] = elapsed_ns_per_op(start, count);
+
+    start = CGL_utils_get_time_ns();
+    for (uint64_t i = 0; i < count; i++) CGL_hashtable_remove(table, &i);
+    times[6] = elapsed_ns_per_op(start, count);
+    CGL_hashtable_destroy(table);
+
+    legacy_table* legacy = legacy_create(count, sizeof(uint64_t), count);
+    if (legacy)
+    {
+        bool scan = count <= previous_limit;
+        start = CGL_utils_get_time_ns();
+        for (uint64_t i = 0; i < count; i++) { value = i * 7; legacy_set(legacy, &i, &value, sizeof(value), scan); }
+        if (scan) times[1] = elapsed_ns_per_op(start, count);
+
+        start = CGL_utils_get_time_ns();
+        for (uint64_t i = 0; i < count; i++) { legacy_get(legacy, &i, &value); checksum -= value; }
+        times[3] = elapsed_ns_per_op(start, count);
+
+        start = CGL_utils_get_time_ns();
+        for (uint64_t i = count; i < count * 2; i++) checksum -= legacy_find(legacy, &i) != NULL;
+        times[5] = elapsed_ns_per_op(start, count);
+        legacy_destroy(legacy);
+    }
+
+    print_row("u64", count, times, checksum); // the checksum is 0 when both tables returned the same values
+}
+
+static void benchmark_string_keys(CGL_sizei count, CGL_sizei previous_limit)
+{
+    double times[7] = { -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0 };
+    char key[64];
+    uint64_t start = 0, value = 0, checksum = 0;
+
+    // small initial capacity so that growth is part of the measurement
+    CGL_hashtable* table = CGL_hashtable_create(16, 0, 16);
+    start = CGL_utils_get_time_ns();
+    for (uint64_t i = 0; i < count; i++) { sprintf(key, "key_%llu", (unsigned long long)i); CGL_hashtable_set(table, key, &i, sizeof(i)); }
+    times[0] = elapsed_ns_per_op(start, count);
+
+    start = CGL_utils_get_time_ns();
+    for (uint64_t i = 0; i < count; i++) { sprintf(key, "key_%llu", (unsigned long long)i); CGL_hashtable_get(table, key, &value); checksum += value; }
+    times[2] = elapsed_ns_per_op(start, count);
+    CGL_hashtable_destroy(table);
+
+    legacy_table* legacy = count <= previous_limit ? legacy_create(16, 0, count) : NULL;
+    if (legacy)
+    {
+        start = CGL_utils_get_time_ns();
+        for (uint64_t i = 0; i < count; i++) { sprintf(key, "key_%llu", (unsigned long long)i); legacy_set(legacy, key, &i, sizeof(i), true); }
+        times[1] = elapsed_ns_per_op(start, count);
+
+        start = CGL_utils_get_time_ns();
+        for (uint64_t i = 0; i < count; i++) { sprintf(key, "key_%llu", (unsigned long long)i); legacy_get(legacy, key, &value); checksum -= value; }
+        times[3] = elapsed_ns_per_op(start, count);
+        legacy_destroy(legacy);
+    }
+
+    print_row("str", count, times, checksum);
+}
+
+int main(int argc, char** argv)
+{
+    int max_exponent = argc > 1 ? atoi(argv[1]) : 7;
+    int previous_max_exponent = argc > 2 ? atoi(argv[2]) : 5;
+    CGL_sizei count = 1000, previous_limit = 1;
+    for (int exponent = 0; exponent < previous_max_exponent; exponent++) previous_limit *= 10;
+    printf("average time per operation, previous is the chained table this one replaced, - is skipped\n");
+    printf("%-4s %10s | %11s %11s | %11s %11s | %11s %11s | %11s | %s\n", "keys", "count", "insert", "previous", "lookup", "previous", "miss", "previous", "remove", "(checksum)");
+    for (int exponent = 3; exponent <= max_exponent; exponent++, count *= 10)
+    {
+        benchmark_integer_keys(count, previous_limit);
+        benchmark_string_keys(count, previous_limit);
+    }
+    return 0;
+}
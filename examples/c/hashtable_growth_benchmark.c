@@ -0,0 +1,87 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+// Measures the latency distribution of CGL_hashtable_set while the table grows from
+// its smallest size. Build with -DCGL_HASHTABLE_INCREMENTAL_REHASH_STEP=SIZE_MAX to
+// compare against a stop-the-world rehash.
+//
+// usage : hashtable_growth_benchmark [entry_count = 4000000]
+
+static int compare_u64(const void* a, const void* b)
+{
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char** argv)
+{
+    CGL_sizei count = argc > 1 ? (CGL_sizei)atoll(argv[1]) : 4000000;
+    uint64_t* latencies = (uint64_t*)CGL_malloc(sizeof(uint64_t) * count);
+    CGL_hashtable* table = CGL_hashtable_create(1, sizeof(uint64_t), 1);
+
+    uint64_t first_key = 0, payload[4] = { 1, 2, 3, 4 }; // larger than the static value size
+    CGL_hashtable_set(table, &first_key, &first_key, sizeof(first_key));
+    void* first_value_ptr = CGL_hashtable_get_ptr(table, &first_key, NULL);
+
+    uint64_t total_start = CGL_utils_get_time_ns();
+    for (uint64_t i = 1; i < count; i++)
+    {
+        uint64_t start = CGL_utils_get_time_ns();
+        if (i & 1) CGL_hashtable_set(table, &i, &i, sizeof(i));
+        else CGL_hashtable_set(table, &i, payload, sizeof(payload));
+        latencies[i] = CGL_utils_get_time_ns() - start;
+    }
+    uint64_t total_time = CGL_utils_get_time_ns() - total_start;
+
+    qsort(latencies + 1, count - 1, sizeof(uint64_t), compare_u64);
+    const CGL_double percentiles[] = { 50.0, 90.0, 99.0, 99.9, 99.99 };
+    printf("inserted %zu entries in %.2f ms (%.1f ns/op)\n", count, total_time / 1e6, (double)total_time / count);
+    for (CGL_sizei i = 0; i < CGL_utils_array_size(percentiles); i++)
+        printf("p%-6.2f : %8llu ns\n", percentiles[i], (unsigned long long)latencies[1 + (CGL_sizei)((count - 2) * percentiles[i] / 100.0)]);
+    printf("max     : %8llu ns\n", (unsigned long long)latencies[count - 1]);
+    printf("pointer from CGL_hashtable_get_ptr %s stable across growth\n", first_value_ptr == CGL_hashtable_get_ptr(table, &first_key, NULL) ? "is" : "is NOT");
+
+    CGL_hashtable_destroy(table);
+    CGL_free(latencies);
+    return 0;
+}
@@ -71,6 +71,11 @@ CGL_bool node_equals(void* user_data, CGL_path_finding_node* node1, CGL_path_fin
     return *data1 == *data2;
 }
 
+CGL_uint node_hash(void* user_data, CGL_path_finding_node* node)
+{
+    return (CGL_uint)*(CGL_int*)node->data_ptr;
+}
+
 CGL_float heuristic(void* user_data, CGL_path_finding_node* node)
 {
     CGL_int* data = (CGL_int*)node->data_ptr;
@@ -131,6 +136,7 @@ int main()
     CGL_tilemap* tilemap = CGL_tilemap_create(TILE_MAP_SIZE, TILE_MAP_SIZE, TILE_SIZE, TILE_SIZE, 1);
     CGL_widgets_init(); // initialize widgets
     path_finding_context = CGL_path_finding_a_star_context_create(TILE_MAP_SIZE * TILE_MAP_SIZE, CGL_TRUE, sizeof(CGL_int));
+    CGL_path_finding_a_star_set_hash_function(path_finding_context, node_hash); // hashed node lookups instead of scanning every node
     while(!CGL_window_should_close(main_window)) // main loop
     { 
         CGL_window_set_size(main_window, MAIN_FRAME_BUFFER_WIDTH, MAIN_FRAME_BUFFER_HEIGHT); // set window size
@@ -0,0 +1,141 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+// Throughput benchmark for the logger. Every thread logs a short formatted
+// message in a loop, with the logger writing to a file (console output is
+// disabled). The synchronous logger is compared against the async mode, the
+// async binary mode (writing a binary log only, so nothing is formatted until
+// it is decoded) and the cost of a message dropped by the level filter.
+//
+// usage : logger_benchmark [max_threads = 8] [messages_per_thread = 200000]
+
+#define MAX_THREADS 64
+#define LOG_FILE_PATH "logger_benchmark.log"
+#define BINARY_LOG_FILE_PATH "logger_benchmark.blog"
+
+typedef struct
+{
+    uint64_t message_count;
+    bool filtered;
+} worker_data;
+
+#ifdef CGL_WINDOWS
+static void worker_function(void* argument)
+#else
+static void* worker_function(void* argument)
+#endif
+{
+    worker_data* data = (worker_data*)argument;
+    for (uint64_t i = 0; i < data->message_count; i++)
+    {
+        if (data->filtered) CGL_trace("frame %llu took %f ms (%d draw calls)", (unsigned long long)i, 16.6f, 42);
+        else CGL_info("frame %llu took %f ms (%d draw calls)", (unsigned long long)i, 16.6f, 42);
+    }
+#ifndef CGL_WINDOWS
+    return NULL;
+#endif
+}
+
+// returns million log calls per second
+static double run(int thread_count, uint64_t messages_per_thread, bool async, bool binary, bool filtered)
+{
+    static CGL_thread* threads[MAX_THREADS];
+    static worker_data data[MAX_THREADS];
+    if (binary)
+    {
+        CGL_logger_detach_log_file(LOG_FILE_PATH);
+        CGL_logger_attach_binary_log_file(BINARY_LOG_FILE_PATH);
+        CGL_logger_set_binary_mode(true);
+    }
+    if (async) CGL_logger_start_async();
+    CGL_logger_set_level(filtered ? CGL_LOG_LEVEL_INFO : CGL_LOG_LEVEL_TRACE);
+
+    uint64_t start = CGL_utils_get_time_ns();
+    for (int i = 0; i < thread_count; i++)
+    {
+        data[i].message_count = messages_per_thread;
+        data[i].filtered = filtered;
+        threads[i] = CGL_thread_create();
+        CGL_thread_start(threads[i], worker_function, &data[i]);
+    }
+    for (int i = 0; i < thread_count; i++) { CGL_thread_join(threads[i]); CGL_thread_destroy(threads[i]); }
+    double seconds = (CGL_utils_get_time_ns() - start) / 1e9;
+
+    // the time to write out what is still staged is not part of the hot path
+    if (async) CGL_logger_stop_async();
+    if (binary)
+    {
+        CGL_logger_set_binary_mode(false);
+        CGL_logger_detach_binary_log_file(BINARY_LOG_FILE_PATH);
+        CGL_logger_attach_log_file(LOG_FILE_PATH);
+    }
+    return (double)(thread_count * messages_per_thread) / seconds / 1e6;
+}
+
+int main(int argc, char** argv)
+{
+    int max_threads = argc > 1 ? atoi(argv[1]) : 8;
+    uint64_t messages_per_thread = argc > 2 ? (uint64_t)atoll(argv[2]) : 200000;
+    max_threads = CGL_utils_clamp(max_threads, 1, MAX_THREADS);
+
+    CGL_init();
+    CGL_logger_disable_console_logging();
+    CGL_logger_attach_log_file(LOG_FILE_PATH);
+
+    printf("threads | sync (Mcalls/s) | async (Mcalls/s) | async binary (Mcalls/s) | filtered (Mcalls/s)\n");
+    for (int thread_count = 1; thread_count <= max_threads; thread_count *= 2)
+    {
+        double sync = run(thread_count, messages_per_thread, false, false, false);
+        double async = run(thread_count, messages_per_thread, true, false, false);
+        double binary = run(thread_count, messages_per_thread, true, true, false);
+        double filtered = run(thread_count, messages_per_thread, true, false, true);
+        printf("%7d | %15.2f | %16.2f | %23.2f | %19.2f\n", thread_count, sync, async, binary, filtered);
+    }
+
+    CGL_logger_detach_log_file(LOG_FILE_PATH);
+    CGL_shutdown();
+    remove(LOG_FILE_PATH);
+    remove(BINARY_LOG_FILE_PATH);
+    return 0;
+}
@@ -0,0 +1,160 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+// GFLOP/s of CGL_matrix_mul_to against the plain triple loop it replaced, for
+// square matrices from 16 up to max_size. The transposed columns multiply by
+// the transpose of one operand with CGL_matrix_mul_transposed_to. Sizes above
+// max_naive_size skip the triple loop as it gets very slow there.
+//
+// usage : matrix_gemm_benchmark [max_size = 2048] [max_naive_size = 1024]
+
+// the multiplication CGL_matrix_mul_to used to do
+static void naive_mul(CGL_matrix* a, CGL_matrix* b, CGL_matrix* out, int size)
+{
+    CGL_MATRIX_DATA_TYPE* ad = a->data; CGL_MATRIX_DATA_TYPE* bd = b->data; CGL_MATRIX_DATA_TYPE* od = out->data;
+    for (int i = 0; i < size; i++)
+        for (int j = 0; j < size; j++)
+        {
+            CGL_MATRIX_DATA_TYPE sum = 0;
+            for (int k = 0; k < size; k++) sum += ad[i * size + k] * bd[k * size + j];
+            od[i * size + j] = sum;
+        }
+}
+
+typedef enum
+{
+    METHOD_NAIVE,
+    METHOD_CGL,
+    METHOD_CGL_AT_B,
+    METHOD_CGL_A_BT,
+    METHOD_COUNT
+} method_type;
+
+static const char* method_names[METHOD_COUNT] = { "naive", "mul_to", "a^t * b", "a * b^t" };
+
+static void run_method(method_type method, CGL_matrix* a, CGL_matrix* b, CGL_matrix* out, int size)
+{
+    switch (method)
+    {
+    case METHOD_NAIVE: naive_mul(a, b, out, size); break;
+    case METHOD_CGL: CGL_matrix_mul_to(a, b, out); break;
+    case METHOD_CGL_AT_B: CGL_matrix_mul_transposed_to(a, true, b, false, out); break;
+    case METHOD_CGL_A_BT: CGL_matrix_mul_transposed_to(a, false, b, true, out); break;
+    default: break;
+    }
+}
+
+// repeats the multiplication for at least a fifth of a second and returns GFLOP/s
+static double measure(method_type method, CGL_matrix* a, CGL_matrix* b, CGL_matrix* out, int size)
+{
+    double flops = 2.0 * size * size * size;
+    uint64_t start = CGL_utils_get_time_ns(), elapsed = 0;
+    int repeats = 0;
+    do
+    {
+        run_method(method, a, b, out, size);
+        repeats++;
+        elapsed = CGL_utils_get_time_ns() - start;
+    } while (elapsed < 200000000ull);
+    return flops * repeats / (double)elapsed;
+}
+
+static double max_difference(CGL_matrix* x, CGL_matrix* y, int size)
+{
+    double result = 0.0;
+    for (int i = 0; i < size * size; i++) result = CGL_utils_max(result, fabs((double)x->data[i] - (double)y->data[i]));
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    int max_size = argc > 1 ? atoi(argv[1]) : 2048;
+    int max_naive_size = argc > 2 ? atoi(argv[2]) : 1024;
+
+    if (!CGL_init()) return 1;
+    srand(42);
+
+    printf("%-8s", "size");
+    for (int method = 0; method < METHOD_COUNT; method++) printf("%12s", method_names[method]);
+    printf("%12s%14s\n", "speedup", "max error");
+
+    for (int size = 16; size <= max_size; size *= 2)
+    {
+        CGL_matrix* a = CGL_matrix_create(size, size);
+        CGL_matrix* b = CGL_matrix_create(size, size);
+        CGL_matrix* out = CGL_matrix_create(size, size);
+        CGL_matrix* expected = CGL_matrix_create(size, size);
+        for (int i = 0; i < size * size; i++)
+        {
+            a->data[i] = (CGL_MATRIX_DATA_TYPE)(CGL_utils_random_float() * 2.0f - 1.0f);
+            b->data[i] = (CGL_MATRIX_DATA_TYPE)(CGL_utils_random_float() * 2.0f - 1.0f);
+        }
+
+        double gflops[METHOD_COUNT] = { 0 };
+        double error = 0.0;
+        bool run_naive = size <= max_naive_size;
+        if (run_naive)
+        {
+            gflops[METHOD_NAIVE] = measure(METHOD_NAIVE, a, b, expected, size);
+            CGL_matrix_mul_to(a, b, out);
+            error = max_difference(out, expected, size);
+        }
+        for (int method = METHOD_CGL; method < METHOD_COUNT; method++) gflops[method] = measure((method_type)method, a, b, out, size);
+
+        printf("%-8d", size);
+        for (int method = 0; method < METHOD_COUNT; method++)
+        {
+            if (method == METHOD_NAIVE && !run_naive) printf("%12s", "-");
+            else printf("%12.2f", gflops[method]);
+        }
+        if (run_naive) printf("%11.1fx%14.2e\n", gflops[METHOD_CGL] / gflops[METHOD_NAIVE], error);
+        else printf("%12s%14s\n", "-", "-");
+
+        CGL_matrix_destroy(a); CGL_matrix_destroy(b); CGL_matrix_destroy(out); CGL_matrix_destroy(expected);
+    }
+
+    CGL_shutdown();
+    return 0;
+}
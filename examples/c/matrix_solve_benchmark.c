@@ -0,0 +1,192 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+// Time taken by the LU / QR / Cholesky based routines of the matrix API for
+// square sizes from 4 up to max_size, next to the recursive cofactor
+// expansion CGL_matrix_determinant used before (only run up to
+// max_cofactor_size as it is O(n!)). Every cell is the average time of one
+// call in microseconds, the last column is the relative residual of the solve.
+//
+// usage : matrix_solve_benchmark [max_size = 1000] [max_cofactor_size = 8]
+
+// the determinant CGL_matrix_determinant used to compute
+static CGL_MATRIX_DATA_TYPE cofactor_determinant(CGL_matrix* m)
+{
+    CGL_int n = m->m;
+    if (n == 1) return CGL_matrix_get_elem(m, 0, 0);
+    if (n == 2) return CGL_matrix_get_elem(m, 0, 0) * CGL_matrix_get_elem(m, 1, 1) - CGL_matrix_get_elem(m, 0, 1) * CGL_matrix_get_elem(m, 1, 0);
+    CGL_MATRIX_DATA_TYPE det = 0;
+    for (CGL_int i = 0; i < n; i++)
+    {
+        CGL_matrix* sub = CGL_matrix_minor(m, 0, i);
+        det += CGL_matrix_get_elem(m, 0, i) * cofactor_determinant(sub) * (i % 2 == 0 ? 1 : -1);
+        CGL_matrix_destroy(sub);
+    }
+    return det;
+}
+
+typedef enum
+{
+    OPERATION_COFACTOR_DETERMINANT,
+    OPERATION_DETERMINANT,
+    OPERATION_INVERSE,
+    OPERATION_SOLVE,
+    OPERATION_LEAST_SQUARES,
+    OPERATION_CHOLESKY_SOLVE,
+    OPERATION_COUNT
+} operation_type;
+
+static const char* operation_names[OPERATION_COUNT] = { "cofactor det", "det", "inverse", "solve", "lstsq 2nxn", "cholesky" };
+
+typedef struct
+{
+    CGL_matrix* a; // general n x n
+    CGL_matrix* tall; // 2n x n
+    CGL_matrix* spd; // symmetric positive definite n x n
+    CGL_matrix* b; // n x 1
+    CGL_matrix* tall_b; // 2n x 1
+    CGL_matrix* x; // n x 1
+    CGL_matrix* inverse; // n x n
+    CGL_matrix* l; // n x n
+} problem;
+
+static volatile double sink;
+
+static void run_operation(operation_type operation, problem* p)
+{
+    switch (operation)
+    {
+    case OPERATION_COFACTOR_DETERMINANT: sink = cofactor_determinant(p->a); break;
+    case OPERATION_DETERMINANT: sink = CGL_matrix_determinant(p->a); break;
+    case OPERATION_INVERSE: CGL_matrix_inverse_to(p->a, p->inverse); break;
+    case OPERATION_SOLVE: CGL_matrix_solve_to(p->a, p->b, p->x); break;
+    case OPERATION_LEAST_SQUARES: CGL_matrix_least_squares_to(p->tall, p->tall_b, p->x); break;
+    case OPERATION_CHOLESKY_SOLVE: CGL_matrix_cholesky_to(p->spd, p->l); CGL_matrix_cholesky_solve_to(p->l, p->b, p->x); break;
+    default: break;
+    }
+}
+
+// repeats the operation for at least a tenth of a second and returns microseconds per call
+static double measure(operation_type operation, problem* p)
+{
+    uint64_t start = CGL_utils_get_time_ns(), elapsed = 0;
+    int repeats = 0;
+    do
+    {
+        run_operation(operation, p);
+        repeats++;
+        elapsed = CGL_utils_get_time_ns() - start;
+    } while (elapsed < 100000000ull);
+    return (double)elapsed / repeats / 1000.0;
+}
+
+static CGL_matrix* random_matrix(int m, int n)
+{
+    CGL_matrix* result = CGL_matrix_create(m, n);
+    for (int i = 0; i < m; i++)
+        for (int j = 0; j < n; j++)
+            CGL_matrix_set_elem(result, i, j, (CGL_MATRIX_DATA_TYPE)(CGL_utils_random_float() * 2.0f - 1.0f));
+    return result;
+}
+
+// |a * x - b| / |b|
+static double relative_residual(CGL_matrix* a, CGL_matrix* x, CGL_matrix* b)
+{
+    CGL_matrix* ax = CGL_matrix_mul(a, x);
+    double residual = 0.0, norm = 0.0;
+    for (int i = 0; i < b->m; i++)
+    {
+        double d = (double)CGL_matrix_get_elem(ax, i, 0) - (double)CGL_matrix_get_elem(b, i, 0);
+        residual += d * d;
+        norm += (double)CGL_matrix_get_elem(b, i, 0) * (double)CGL_matrix_get_elem(b, i, 0);
+    }
+    CGL_matrix_destroy(ax);
+    return sqrt(residual / norm);
+}
+
+int main(int argc, char** argv)
+{
+    int max_size = argc > 1 ? atoi(argv[1]) : 1000;
+    int max_cofactor_size = argc > 2 ? atoi(argv[2]) : 8;
+
+    if (!CGL_init()) return 1;
+    srand(42);
+
+    static const int sizes[] = { 4, 8, 16, 32, 64, 128, 256, 512, 1000 };
+    printf("%-6s", "size");
+    for (int operation = 0; operation < OPERATION_COUNT; operation++) printf("%14s", operation_names[operation]);
+    printf("%14s\n", "residual");
+
+    for (int s = 0; s < (int)(sizeof(sizes) / sizeof(sizes[0])) && sizes[s] <= max_size; s++)
+    {
+        int n = sizes[s];
+        problem p;
+        p.a = random_matrix(n, n);
+        p.tall = random_matrix(2 * n, n);
+        p.b = random_matrix(n, 1);
+        p.tall_b = random_matrix(2 * n, 1);
+        p.x = CGL_matrix_create(n, 1);
+        p.inverse = CGL_matrix_create(n, n);
+        p.l = CGL_matrix_create(n, n);
+        p.spd = CGL_matrix_mul_transposed(p.a, false, p.a, true); // a * a^t + n * i
+        for (int i = 0; i < n; i++) CGL_matrix_set_elem(p.spd, i, i, CGL_matrix_get_elem(p.spd, i, i) + (CGL_MATRIX_DATA_TYPE)n);
+
+        printf("%-6d", n);
+        for (int operation = 0; operation < OPERATION_COUNT; operation++)
+        {
+            if (operation == OPERATION_COFACTOR_DETERMINANT && n > max_cofactor_size) { printf("%14s", "-"); continue; }
+            printf("%14.2f", measure((operation_type)operation, &p));
+            fflush(stdout);
+        }
+        CGL_matrix_solve_to(p.a, p.b, p.x);
+        printf("%14.2e\n", relative_residual(p.a, p.x, p.b));
+
+        CGL_matrix_destroy(p.a); CGL_matrix_destroy(p.tall); CGL_matrix_destroy(p.spd); CGL_matrix_destroy(p.b);
+        CGL_matrix_destroy(p.tall_b); CGL_matrix_destroy(p.x); CGL_matrix_destroy(p.inverse); CGL_matrix_destroy(p.l);
+    }
+
+    CGL_shutdown();
+    return 0;
+}
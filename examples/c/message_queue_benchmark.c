@@ -0,0 +1,197 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+// Throughput benchmark for CGL_spsc_queue and CGL_mpmc_queue. Producer threads
+// hand small messages to consumer threads, once through the lock free queues
+// (one item at a time and in batches) and once through a CGL_list guarded by a
+// CGL_mutex, which is what the queues are meant to replace.
+//
+// usage : message_queue_benchmark [producers = 4] [messages_per_producer = 1000000]
+
+#define MAX_THREADS 32
+#define BATCH_SIZE 32
+#define QUEUE_CAPACITY 4096
+
+typedef struct
+{
+    uint64_t id;
+    float position[3];
+    float velocity[3];
+} message;
+
+typedef enum
+{
+    METHOD_SPSC,
+    METHOD_SPSC_BATCH,
+    METHOD_MPMC,
+    METHOD_MPMC_BATCH,
+    METHOD_MUTEX_LIST
+} method_type;
+
+typedef struct
+{
+    method_type method;
+    uint64_t message_count; // messages to produce or to consume
+    uint64_t id_sum;
+} worker_data;
+
+static CGL_spsc_queue* spsc_queue;
+static CGL_mpmc_queue* mpmc_queue;
+static CGL_list* list;
+static CGL_mutex* list_mutex;
+
+#ifdef CGL_WINDOWS
+static void producer_function(void* argument)
+#else
+static void* producer_function(void* argument)
+#endif
+{
+    worker_data* data = (worker_data*)argument;
+    message batch[BATCH_SIZE] = { 0 };
+    for (uint64_t i = 0; i < data->message_count; )
+    {
+        size_t count = (data->method == METHOD_SPSC_BATCH || data->method == METHOD_MPMC_BATCH) ? (size_t)CGL_utils_min(BATCH_SIZE, data->message_count - i) : 1;
+        for (size_t j = 0; j < count; j++) batch[j].id = i + j + 1;
+        switch (data->method)
+        {
+        case METHOD_SPSC: CGL_spsc_queue_push(spsc_queue, batch); break;
+        case METHOD_SPSC_BATCH: CGL_spsc_queue_push_batch(spsc_queue, batch, count); break;
+        case METHOD_MPMC: CGL_mpmc_queue_push(mpmc_queue, batch); break;
+        case METHOD_MPMC_BATCH: CGL_mpmc_queue_push_batch(mpmc_queue, batch, count); break;
+        case METHOD_MUTEX_LIST: CGL_mutex_lock(list_mutex, 0); CGL_list_push(list, batch); CGL_mutex_release(list_mutex); break;
+        }
+        i += count;
+    }
+#ifndef CGL_WINDOWS
+    return NULL;
+#endif
+}
+
+#ifdef CGL_WINDOWS
+static void consumer_function(void* argument)
+#else
+static void* consumer_function(void* argument)
+#endif
+{
+    worker_data* data = (worker_data*)argument;
+    message batch[BATCH_SIZE];
+    data->id_sum = 0;
+    for (uint64_t i = 0; i < data->message_count; )
+    {
+        size_t count = 0;
+        size_t max_count = (size_t)CGL_utils_min(BATCH_SIZE, data->message_count - i);
+        switch (data->method)
+        {
+        case METHOD_SPSC: CGL_spsc_queue_pop(spsc_queue, batch); count = 1; break;
+        case METHOD_SPSC_BATCH: count = CGL_spsc_queue_pop_batch(spsc_queue, batch, max_count); break;
+        case METHOD_MPMC: CGL_mpmc_queue_pop(mpmc_queue, batch); count = 1; break;
+        case METHOD_MPMC_BATCH: count = CGL_mpmc_queue_pop_batch(mpmc_queue, batch, max_count); break;
+        case METHOD_MUTEX_LIST:
+            CGL_mutex_lock(list_mutex, 0);
+            if (!CGL_list_is_empty(list)) { CGL_list_pop(list, batch); count = 1; }
+            CGL_mutex_release(list_mutex);
+            if (count == 0) CGL_thread_yield();
+            break;
+        }
+        for (size_t j = 0; j < count; j++) data->id_sum += batch[j].id;
+        i += count;
+    }
+#ifndef CGL_WINDOWS
+    return NULL;
+#endif
+}
+
+// returns million messages per second
+static double run(method_type method, int producers, int consumers, uint64_t messages_per_producer)
+{
+    static CGL_thread* threads[MAX_THREADS * 2];
+    static worker_data data[MAX_THREADS * 2];
+    uint64_t total = messages_per_producer * (uint64_t)producers;
+    spsc_queue = CGL_spsc_queue_create(QUEUE_CAPACITY, sizeof(message));
+    mpmc_queue = CGL_mpmc_queue_create(QUEUE_CAPACITY, sizeof(message));
+    list = CGL_list_create(sizeof(message), QUEUE_CAPACITY);
+    list_mutex = CGL_mutex_create(false);
+
+    uint64_t start = CGL_utils_get_time_ns();
+    for (int i = 0; i < producers + consumers; i++)
+    {
+        data[i].method = method;
+        if (i < producers) data[i].message_count = messages_per_producer;
+        else data[i].message_count = total / consumers + ((uint64_t)(i - producers) < total % consumers ? 1 : 0);
+        threads[i] = CGL_thread_create();
+        CGL_thread_start(threads[i], i < producers ? producer_function : consumer_function, &data[i]);
+    }
+    uint64_t id_sum = 0;
+    for (int i = 0; i < producers + consumers; i++)
+    {
+        CGL_thread_join(threads[i]);
+        CGL_thread_destroy(threads[i]);
+        if (i >= producers) id_sum += data[i].id_sum;
+    }
+    double seconds = (CGL_utils_get_time_ns() - start) / 1e9;
+    if (id_sum != (uint64_t)producers * messages_per_producer * (messages_per_producer + 1) / 2) printf("error : messages were lost or duplicated\n");
+
+    CGL_mutex_destroy(list_mutex);
+    CGL_list_destroy(list);
+    CGL_mpmc_queue_destroy(mpmc_queue);
+    CGL_spsc_queue_destroy(spsc_queue);
+    return (double)total / seconds / 1e6;
+}
+
+int main(int argc, char** argv)
+{
+    int producers = argc > 1 ? atoi(argv[1]) : 4;
+    uint64_t messages_per_producer = argc > 2 ? (uint64_t)atoll(argv[2]) : 1000000;
+    producers = CGL_utils_clamp(producers, 1, MAX_THREADS);
+
+    printf("method                  | threads | Mmsg/s\n");
+    printf("spsc queue              |   1 : 1 | %6.2f\n", run(METHOD_SPSC, 1, 1, messages_per_producer));
+    printf("spsc queue (batch %2d)   |   1 : 1 | %6.2f\n", BATCH_SIZE, run(METHOD_SPSC_BATCH, 1, 1, messages_per_producer));
+    printf("mpmc queue              |   1 : 1 | %6.2f\n", run(METHOD_MPMC, 1, 1, messages_per_producer));
+    printf("mutex + list            |   1 : 1 | %6.2f\n", run(METHOD_MUTEX_LIST, 1, 1, messages_per_producer));
+    printf("mpmc queue              | %3d :%2d | %6.2f\n", producers, producers, run(METHOD_MPMC, producers, producers, messages_per_producer));
+    printf("mpmc queue (batch %2d)   | %3d :%2d | %6.2f\n", BATCH_SIZE, producers, producers, run(METHOD_MPMC_BATCH, producers, producers, messages_per_producer));
+    printf("mutex + list            | %3d :%2d | %6.2f\n", producers, producers, run(METHOD_MUTEX_LIST, producers, producers, messages_per_producer));
+    return 0;
+}
@@ -0,0 +1,196 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+
+
+// Neighbour queries of a boids style simulation on CGL_quad_tree: every item
+// asks for the items within a radius and for its k nearest items. The exact
+// queries are timed against the usual workaround of fetching the bounding box
+// with CGL_quad_tree_get_items_in_range and filtering by distance (growing the
+// box until it holds k items for the nearest query), and the batch versions
+// are timed on the calling thread and on the default thread pool.
+//
+// usage : nd_tree_query_benchmark [items = 100000] [radius = 0.02] [k = 8]
+
+static double now_ms()
+{
+    return (double)CGL_utils_get_time_ns() * 1e-6;
+}
+
+static CGL_float random_float()
+{
+    return (CGL_float)rand() / (CGL_float)RAND_MAX;
+}
+
+static CGL_float distance_squared(const CGL_float* positions, CGL_int item, CGL_float x, CGL_float y)
+{
+    CGL_float dx = positions[item * 2] - x, dy = positions[item * 2 + 1] - y;
+    return dx * dx + dy * dy;
+}
+
+// box query then distance filter, returns the number of items within radius
+static CGL_int radius_by_box(CGL_nd_tree* tree, const CGL_float* positions, CGL_float x, CGL_float y, CGL_float radius, CGL_int* scratch, CGL_int max_items, CGL_int* items_out)
+{
+    CGL_int found = CGL_quad_tree_get_items_in_range(tree, x - radius, y - radius, x + radius, y + radius, scratch, max_items);
+    CGL_int count = 0;
+    for (CGL_int i = 0; i < found; i++) if (distance_squared(positions, scratch[i], x, y) <= radius * radius) items_out[count++] = scratch[i];
+    return count;
+}
+
+// grows the box until it holds k items, then keeps the k closest of the items within the box half size
+static CGL_int nearest_by_box(CGL_nd_tree* tree, const CGL_float* positions, CGL_float x, CGL_float y, CGL_int k, CGL_float initial_half_size, CGL_int* scratch, CGL_int max_items, CGL_int* items_out, CGL_float* distances_out)
+{
+    CGL_float half_size = initial_half_size;
+    CGL_int found = 0;
+    for (;;)
+    {
+        found = CGL_quad_tree_get_items_in_range(tree, x - half_size, y - half_size, x + half_size, y + half_size, scratch, max_items);
+        CGL_int inside = 0; // only items within the inscribed circle are guaranteed to beat everything outside the box
+        for (CGL_int i = 0; i < found; i++) if (distance_squared(positions, scratch[i], x, y) <= half_size * half_size) inside++;
+        if (inside >= k || half_size > 2.0f) break;
+        half_size *= 2.0f;
+    }
+    CGL_int count = 0;
+    for (CGL_int i = 0; i < found; i++)
+    {
+        CGL_float d = distance_squared(positions, scratch[i], x, y);
+        if (count == k && d >= distances_out[count - 1]) continue;
+        CGL_int j = count < k ? count++ : count - 1; // insertion into the sorted k best
+        while (j > 0 && distances_out[j - 1] > d) { distances_out[j] = distances_out[j - 1]; items_out[j] = items_out[j - 1]; j--; }
+        distances_out[j] = d; items_out[j] = scratch[i];
+    }
+    return count;
+}
+
+int main(int argc, char** argv)
+{
+    CGL_int count = argc > 1 ? atoi(argv[1]) : 100000;
+    CGL_float radius = argc > 2 ? (CGL_float)atof(argv[2]) : 0.02f;
+    CGL_int k = argc > 3 ? atoi(argv[3]) : 8;
+    CGL_thread_pool* pool = CGL_thread_pool_get_default();
+    printf("%d items, radius %g, k %d, %zu worker threads\n", count, radius, k, pool ? CGL_thread_pool_get_worker_count(pool) : 0);
+
+    CGL_float* positions = (CGL_float*)malloc(sizeof(CGL_float) * 2 * count);
+    CGL_int* scratch = (CGL_int*)malloc(sizeof(CGL_int) * count);
+    CGL_int* items = (CGL_int*)malloc(sizeof(CGL_int) * count);
+    CGL_float* distances = (CGL_float*)malloc(sizeof(CGL_float) * count);
+    CGL_int* counts = (CGL_int*)malloc(sizeof(CGL_int) * count);
+    CGL_int* batch_items = (CGL_int*)malloc(sizeof(CGL_int) * count * k);
+    CGL_nd_tree* tree = CGL_quad_tree_create(sizeof(CGL_int), 64, count, count * 4, true);
+    if (!positions || !scratch || !items || !distances || !counts || !batch_items || !tree) { printf("out of memory\n"); return 1; }
+    CGL_quad_tree_reset(tree, 0.0f, 0.0f, 1.0f, 1.0f, 16, 10, false);
+    for (CGL_int i = 0; i < count; i++)
+    {
+        positions[i * 2] = random_float(); positions[i * 2 + 1] = random_float();
+        CGL_quad_tree_add(tree, positions[i * 2], positions[i * 2 + 1], &i);
+    }
+
+    long long checksum_box = 0, checksum_exact = 0, checksum_batch = 0;
+    CGL_int max_found = 1;
+    double start = now_ms();
+    for (CGL_int i = 0; i < count; i++) checksum_box += radius_by_box(tree, positions, positions[i * 2], positions[i * 2 + 1], radius, scratch, count, items);
+    double box_radius = now_ms() - start;
+    start = now_ms();
+    for (CGL_int i = 0; i < count; i++)
+    {
+        CGL_int found = CGL_quad_tree_get_items_in_radius(tree, positions[i * 2], positions[i * 2 + 1], radius, items, count);
+        checksum_exact += found;
+        max_found = CGL_utils_max(max_found, found);
+    }
+    double exact_radius = now_ms() - start;
+    if (checksum_box != checksum_exact) printf("radius results differ %lld %lld\n", checksum_box, checksum_exact);
+    // the batch output holds count * max_items items, sized from the exact queries so that no query is cut short
+    CGL_int* batch_radius_items = (CGL_int*)malloc(sizeof(CGL_int) * count * max_found);
+    if (!batch_radius_items) { printf("out of memory\n"); return 1; }
+    start = now_ms();
+    CGL_nd_tree_get_items_in_radius_batch(tree, positions, count, radius, batch_radius_items, max_found, counts, false);
+    double batch_radius = now_ms() - start;
+    start = now_ms();
+    CGL_nd_tree_get_items_in_radius_batch(tree, positions, count, radius, batch_radius_items, max_found, counts, true);
+    double batch_radius_threads = now_ms() - start;
+    for (CGL_int i = 0; i < count; i++) checksum_batch += counts[i];
+    if (checksum_batch != checksum_exact) printf("batch radius results differ %lld %lld\n", checksum_batch, checksum_exact);
+    free(batch_radius_items);
+
+    CGL_float initial_half_size = sqrtf((CGL_float)k / (CGL_float)count) * 0.5f; // a box expected to hold about k items
+    double sum_box = 0.0, sum_exact = 0.0;
+    start = now_ms();
+    for (CGL_int i = 0; i < count; i++)
+    {
+        CGL_int found = nearest_by_box(tree, positions, positions[i * 2], positions[i * 2 + 1], k, initial_half_size, scratch, count, items, distances);
+        for (CGL_int j = 0; j < found; j++) sum_box += distances[j];
+    }
+    double box_nearest = now_ms() - start;
+    start = now_ms();
+    for (CGL_int i = 0; i < count; i++)
+    {
+        CGL_int found = CGL_quad_tree_get_nearest_items(tree, positions[i * 2], positions[i * 2 + 1], k, items, distances);
+        for (CGL_int j = 0; j < found; j++) sum_exact += distances[j];
+    }
+    double exact_nearest = now_ms() - start;
+    if (fabs(sum_box - sum_exact) > 1e-3 * fabs(sum_exact)) printf("nearest results differ %g %g\n", sum_box, sum_exact);
+    start = now_ms();
+    CGL_nd_tree_get_nearest_items_batch(tree, positions, count, k, batch_items, NULL, counts, false);
+    double batch_nearest = now_ms() - start;
+    start = now_ms();
+    CGL_nd_tree_get_nearest_items_batch(tree, positions, count, k, batch_items, NULL, counts, true);
+    double batch_nearest_threads = now_ms() - start;
+
+    printf("radius queries (%.1f items found on average)\n", (double)checksum_exact / count);
+    printf("    %-40s %8.3f ms\n", "box query and filter", box_radius);
+    printf("    %-40s %8.3f ms\n", "CGL_quad_tree_get_items_in_radius", exact_radius);
+    printf("    %-40s %8.3f ms\n", "batch", batch_radius);
+    printf("    %-40s %8.3f ms\n", "batch (threads)", batch_radius_threads);
+    printf("nearest %d queries\n", k);
+    printf("    %-40s %8.3f ms\n", "growing box query and filter", box_nearest);
+    printf("    %-40s %8.3f ms\n", "CGL_quad_tree_get_nearest_items", exact_nearest);
+    printf("    %-40s %8.3f ms\n", "batch", batch_nearest);
+    printf("    %-40s %8.3f ms\n", "batch (threads)", batch_nearest_threads);
+
+    CGL_nd_tree_destroy(tree);
+    free(positions); free(scratch); free(items); free(distances); free(counts); free(batch_items);
+    CGL_shutdown();
+    return 0;
+}
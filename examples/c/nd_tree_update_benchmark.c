@@ -0,0 +1,130 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+
+
+// Keeping a CGL_quad_tree in sync with a scene of mostly static items where a
+// fraction of them moves every frame. The tree is either rebuilt from scratch
+// with CGL_quad_tree_reset and CGL_quad_tree_add, or kept and updated with
+// CGL_quad_tree_move for the movers only.
+//
+// usage : nd_tree_update_benchmark [items = 100000] [frames = 100]
+
+static double now_ms()
+{
+    return (double)CGL_utils_get_time_ns() * 1e-6;
+}
+
+static CGL_float random_float()
+{
+    return (CGL_float)rand() / (CGL_float)RAND_MAX;
+}
+
+static CGL_float wrap(CGL_float x)
+{
+    return x < 0.0f ? x + 1.0f : (x >= 1.0f ? x - 1.0f : x);
+}
+
+// the movers are the first mover_count items, they drift a little every frame
+static void move_items(CGL_float* positions, CGL_int mover_count, int frame)
+{
+    for (CGL_int i = 0; i < mover_count; i++)
+    {
+        positions[i * 2] = wrap(positions[i * 2] + 0.002f * cosf((CGL_float)(i + frame)));
+        positions[i * 2 + 1] = wrap(positions[i * 2 + 1] + 0.002f * sinf((CGL_float)(i + frame)));
+    }
+}
+
+static double run_rebuild(CGL_nd_tree* tree, CGL_float* positions, CGL_int count, CGL_int mover_count, int frames)
+{
+    double start = now_ms();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        move_items(positions, mover_count, frame);
+        CGL_quad_tree_reset(tree, 0.0f, 0.0f, 1.0f, 1.0f, 16, 10, false);
+        for (CGL_int i = 0; i < count; i++) CGL_quad_tree_add(tree, positions[i * 2], positions[i * 2 + 1], &i);
+    }
+    return now_ms() - start;
+}
+
+static double run_incremental(CGL_nd_tree* tree, CGL_float* positions, CGL_int* handles, CGL_int count, CGL_int mover_count, int frames)
+{
+    CGL_quad_tree_reset(tree, 0.0f, 0.0f, 1.0f, 1.0f, 16, 10, false);
+    for (CGL_int i = 0; i < count; i++) handles[i] = CGL_quad_tree_insert(tree, positions[i * 2], positions[i * 2 + 1], &i);
+    double start = now_ms();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        move_items(positions, mover_count, frame);
+        for (CGL_int i = 0; i < mover_count; i++) CGL_quad_tree_move(tree, handles[i], positions[i * 2], positions[i * 2 + 1]);
+    }
+    return now_ms() - start;
+}
+
+int main(int argc, char** argv)
+{
+    CGL_int count = argc > 1 ? atoi(argv[1]) : 100000;
+    int frames = argc > 2 ? atoi(argv[2]) : 100;
+    CGL_float* positions = (CGL_float*)malloc(sizeof(CGL_float) * 2 * count);
+    CGL_int* handles = (CGL_int*)malloc(sizeof(CGL_int) * count);
+    CGL_nd_tree* tree = CGL_quad_tree_create(sizeof(CGL_int), 64, count, count * 4, true);
+    if (!positions || !handles || !tree) { printf("out of memory\n"); return 1; }
+    printf("%d items, %d frames\n", count, frames);
+    printf("%10s %16s %16s\n", "movers", "rebuild ms", "incremental ms");
+    CGL_float mover_fractions[] = { 0.001f, 0.01f, 0.1f, 0.5f, 1.0f };
+    for (int i = 0; i < 5; i++)
+    {
+        CGL_int mover_count = (CGL_int)(count * mover_fractions[i]);
+        srand(1);
+        for (CGL_int j = 0; j < count * 2; j++) positions[j] = random_float();
+        double rebuild = run_rebuild(tree, positions, count, mover_count, frames);
+        srand(1);
+        for (CGL_int j = 0; j < count * 2; j++) positions[j] = random_float();
+        double incremental = run_incremental(tree, positions, handles, count, mover_count, frames);
+        printf("%9.1f%% %16.3f %16.3f\n", mover_fractions[i] * 100.0f, rebuild / frames, incremental / frames);
+    }
+    CGL_nd_tree_destroy(tree);
+    free(positions); free(handles);
+    return 0;
+}
@@ -0,0 +1,186 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+
+
+// Update cost of CGL_particle_system per million particles: gravity, drag, a
+// swirl force callback, integration, aging and swap removal of the dead with
+// an emitter keeping the population steady. It is run on the calling thread and
+// on the default thread pool, next to the same update written as a plain
+// array of structs loop the way the particle examples hand roll it.
+//
+// usage : particle_system_benchmark [particles = 1000000] [updates = 200]
+
+typedef struct aos_particle
+{
+    CGL_vec3 position;
+    CGL_vec3 velocity;
+    CGL_vec4 color;
+    CGL_float size;
+    CGL_float age;
+    CGL_float lifetime;
+} aos_particle;
+
+static double now_ms()
+{
+    return (double)CGL_utils_get_time_ns() * 1e-6;
+}
+
+static CGL_float random_float()
+{
+    return (CGL_float)rand() / (CGL_float)RAND_MAX;
+}
+
+// pulls every particle around the y axis
+static void swirl(CGL_particle_arrays* particles, CGL_sizei begin, CGL_sizei end, CGL_float delta_time, CGL_void* user_data)
+{
+    CGL_float strength = *(CGL_float*)user_data * delta_time;
+    CGL_float* px = particles->position.x; CGL_float* pz = particles->position.z;
+    CGL_float* vx = particles->velocity.x; CGL_float* vz = particles->velocity.z;
+    for (CGL_sizei i = begin; i < end; i++)
+    {
+        vx[i] -= pz[i] * strength;
+        vz[i] += px[i] * strength;
+    }
+}
+
+static void spawn(CGL_particle_arrays* particles, CGL_sizei begin, CGL_sizei end, CGL_void* user_data)
+{
+    (void)user_data;
+    for (CGL_sizei i = begin; i < end; i++)
+    {
+        particles->velocity.x[i] = random_float() * 2.0f - 1.0f;
+        particles->velocity.y[i] = random_float() * 4.0f;
+        particles->velocity.z[i] = random_float() * 2.0f - 1.0f;
+        particles->color.x[i] = random_float();
+        particles->lifetime[i] = 1.0f + random_float() * 4.0f;
+        particles->age[i] = random_float() * particles->lifetime[i]; // spread the deaths over time
+    }
+}
+
+static double run_system(size_t count, int updates, CGL_bool multithreaded)
+{
+    CGL_float strength = 0.5f;
+    CGL_particle_system* system = CGL_particle_system_create(count);
+    if (!system) return -1.0;
+    CGL_particle_system_set_gravity(system, CGL_vec3_init(0.0f, -9.8f, 0.0f));
+    CGL_particle_system_set_drag(system, 0.1f);
+    CGL_particle_system_set_multithreaded(system, multithreaded);
+    CGL_particle_system_add_force(system, swirl, &strength);
+    CGL_particle_system_emit(system, count, spawn, NULL);
+    // replaces roughly what dies each update (mean lifetime 3 s at 60 updates per second)
+    CGL_particle_system_add_emitter(system, spawn, (CGL_float)count / 3.0f, NULL);
+    double start = now_ms();
+    for (int i = 0; i < updates; i++) CGL_particle_system_update(system, 1.0f / 60.0f);
+    double elapsed = now_ms() - start;
+    CGL_particle_system_destroy(system);
+    return elapsed;
+}
+
+static double run_aos(size_t count, int updates)
+{
+    aos_particle* particles = (aos_particle*)malloc(count * sizeof(aos_particle));
+    if (!particles) return -1.0;
+    size_t alive = count;
+    for (size_t i = 0; i < count; i++)
+    {
+        aos_particle* p = &particles[i];
+        p->position = CGL_vec3_init(0.0f, 0.0f, 0.0f);
+        p->velocity = CGL_vec3_init(random_float() * 2.0f - 1.0f, random_float() * 4.0f, random_float() * 2.0f - 1.0f);
+        p->color = CGL_vec4_init(random_float(), 1.0f, 1.0f, 1.0f);
+        p->size = 1.0f;
+        p->lifetime = 1.0f + random_float() * 4.0f;
+        p->age = random_float() * p->lifetime;
+    }
+    CGL_float dt = 1.0f / 60.0f, strength = 0.5f * dt, damping = 1.0f - 0.1f * dt, spawn_accumulator = 0.0f;
+    double start = now_ms();
+    for (int u = 0; u < updates; u++)
+    {
+        for (size_t i = 0; i < alive;)
+        {
+            aos_particle* p = &particles[i];
+            p->velocity.x -= p->position.z * strength;
+            p->velocity.z += p->position.x * strength;
+            p->velocity.y -= 9.8f * dt;
+            p->velocity = CGL_vec3_scale(p->velocity, damping);
+            p->position = CGL_vec3_add_scaled(p->position, p->velocity, dt);
+            p->age += dt;
+            if (p->age >= p->lifetime) particles[i] = particles[--alive];
+            else i++;
+        }
+        spawn_accumulator += (CGL_float)count / 3.0f * dt;
+        for (; spawn_accumulator >= 1.0f && alive < count; spawn_accumulator -= 1.0f)
+        {
+            aos_particle* p = &particles[alive++];
+            p->position = CGL_vec3_init(0.0f, 0.0f, 0.0f);
+            p->velocity = CGL_vec3_init(random_float() * 2.0f - 1.0f, random_float() * 4.0f, random_float() * 2.0f - 1.0f);
+            p->color = CGL_vec4_init(random_float(), 1.0f, 1.0f, 1.0f);
+            p->size = 1.0f;
+            p->lifetime = 1.0f + random_float() * 4.0f;
+            p->age = 0.0f;
+        }
+    }
+    double elapsed = now_ms() - start;
+    free(particles);
+    return elapsed;
+}
+
+int main(int argc, char** argv)
+{
+    size_t count = argc > 1 ? (size_t)atoll(argv[1]) : 1000000;
+    int updates = argc > 2 ? atoi(argv[2]) : 200;
+    CGL_thread_pool* pool = CGL_thread_pool_get_default();
+    printf("%zu particles, %d updates, %zu worker threads\n", count, updates, pool ? CGL_thread_pool_get_worker_count(pool) : 0);
+    double per_million = 1e6 / (double)count / (double)updates;
+    double aos = run_aos(count, updates);
+    double single = run_system(count, updates, false);
+    double parallel = run_system(count, updates, true);
+    if (aos < 0.0 || single < 0.0 || parallel < 0.0) { printf("out of memory\n"); return 1; }
+    printf("%-32s %8.3f ms per update per million particles\n", "array of structs loop", aos * per_million);
+    printf("%-32s %8.3f ms per update per million particles\n", "CGL_particle_system", single * per_million);
+    printf("%-32s %8.3f ms per update per million particles\n", "CGL_particle_system (threads)", parallel * per_million);
+    CGL_shutdown();
+    return 0;
+}
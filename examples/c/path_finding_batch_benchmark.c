@@ -0,0 +1,125 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+
+
+// CGL_path_finding_batch against a loop of CGL_path_finding_grid_find_path
+// calls for agents walking between random cells of a grid with 15% walls, once
+// for long queries across the grid and once for short ones of at most 32 cells
+// in every axis. Short queries touch few cells, so they show what resetting the
+// search state costs: searches are stamped with a generation instead of being
+// cleared, the last column is what clearing every cell state would cost.
+//
+// usage : path_finding_batch_benchmark [agents = 1000] [size = 512]
+
+static double now_ms()
+{
+    return (double)CGL_utils_get_time_ns() * 1e-6;
+}
+
+static CGL_int random_int(CGL_int max)
+{
+    return (CGL_int)(((CGL_sizei)rand() * RAND_MAX + rand()) % (CGL_sizei)max);
+}
+
+int main(int argc, char** argv)
+{
+    CGL_init();
+    CGL_int agents = argc > 1 ? atoi(argv[1]) : 1000;
+    CGL_int size = argc > 2 ? atoi(argv[2]) : 512;
+    CGL_sizei cells = (CGL_sizei)size * size;
+    CGL_ubyte* bits = (CGL_ubyte*)calloc(cells / 8 + 1, 1);
+    CGL_int* queries = (CGL_int*)malloc(sizeof(CGL_int) * 4 * agents);
+    CGL_int* path = (CGL_int*)malloc(sizeof(CGL_int) * 256);
+    if (!bits || !queries || !path) { printf("out of memory\n"); return 1; }
+    srand(42);
+    for (CGL_sizei i = 0; i < cells; i++) if (rand() % 100 >= 15) bits[i >> 3] |= (CGL_ubyte)(1 << (i & 7));
+    CGL_path_finding_grid* grid = CGL_path_finding_grid_create(size, size, bits);
+    CGL_path_finding_batch* batch = CGL_path_finding_batch_create(grid, 256);
+    if (!grid || !batch) { printf("out of memory\n"); return 1; }
+    printf("%d agents on a %dx%d grid, %d hardware threads\n", agents, size, size, (CGL_int)CGL_thread_get_hardware_concurrency());
+    printf("%8s %15s %15s %15s %15s %15s\n", "queries", "loop", "batch", "batch threads", "per query", "full clear");
+    for (CGL_int test = 0; test < 2; test++)
+    {
+        CGL_int reach = test == 0 ? size : 32;
+        for (CGL_int i = 0; i < agents; i++)
+        {
+            CGL_int x = random_int(size), y = random_int(size);
+            CGL_int gx = x + random_int(reach * 2 + 1) - reach, gy = y + random_int(reach * 2 + 1) - reach;
+            if (test == 0) { gx = random_int(size); gy = random_int(size); }
+            gx = CGL_utils_clamp(gx, 0, size - 1); gy = CGL_utils_clamp(gy, 0, size - 1);
+            queries[i * 4] = x; queries[i * 4 + 1] = y; queries[i * 4 + 2] = gx; queries[i * 4 + 3] = gy;
+        }
+
+        double start = now_ms();
+        CGL_int found = 0;
+        for (CGL_int i = 0; i < agents; i++) found += CGL_path_finding_grid_find_path(grid, CGL_PATH_FINDING_GRID_JPS, queries[i * 4], queries[i * 4 + 1], queries[i * 4 + 2], queries[i * 4 + 3], path, 256, NULL) >= 0;
+        double loop = now_ms() - start;
+        start = now_ms();
+        CGL_path_finding_batch_run(batch, CGL_PATH_FINDING_GRID_JPS, queries, agents, false);
+        double single = now_ms() - start;
+        start = now_ms();
+        CGL_path_finding_batch_run(batch, CGL_PATH_FINDING_GRID_JPS, queries, agents, true);
+        double threaded = now_ms() - start;
+        CGL_int batch_found = 0;
+        for (CGL_int i = 0; i < agents; i++) batch_found += CGL_path_finding_batch_get_path(batch, i, NULL, NULL) >= 0;
+        if (batch_found != found) printf("batch found %d paths, the loop %d\n", batch_found, found);
+
+        // what a search that clears its state first would pay on top, 16 bytes per cell of the grid
+        CGL_ubyte* states = (CGL_ubyte*)malloc(cells * 16);
+        void* (*volatile clear_function)(void*, int, size_t) = memset; // keeps the clears from being optimized away
+        start = now_ms();
+        for (CGL_int i = 0; i < 8; i++) clear_function(states, i, cells * 16);
+        double clear = (now_ms() - start) / 8.0;
+        free(states);
+
+        printf("%8s %12.3f ms %12.3f ms %12.3f ms %12.3f us %12.3f us\n", test == 0 ? "long" : "short", loop, single, threaded, threaded * 1000.0 / agents, clear * 1000.0);
+    }
+    CGL_path_finding_batch_destroy(batch);
+    CGL_path_finding_grid_destroy(grid);
+    free(bits); free(queries); free(path);
+    CGL_shutdown();
+    return 0;
+}
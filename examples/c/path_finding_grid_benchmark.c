@@ -0,0 +1,114 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+
+
+// CGL_path_finding_grid queries per second on square grids with 15% random
+// walls, 8 connected, between random walkable cells, for a*, jump point search
+// and bidirectional a*, plus the time to build a flow field over the whole
+// grid. Every algorithm answers the same queries, their costs are compared.
+//
+// usage : path_finding_grid_benchmark [queries = 200]
+
+static double now_ms()
+{
+    return (double)CGL_utils_get_time_ns() * 1e-6;
+}
+
+int main(int argc, char** argv)
+{
+    CGL_init();
+    CGL_int queries = argc > 1 ? atoi(argv[1]) : 200;
+    CGL_int sizes[] = { 128, 512, 1024, 2048 };
+    const char* names[] = { "a*", "jps", "bidirectional" };
+    printf("%d queries per size\n", queries);
+    printf("%6s %15s %15s %15s %15s %15s %15s %15s\n", "size", "a* q/s", "jps q/s", "bidir q/s", "a* expanded", "jps expanded", "bidir expanded", "flow field");
+    for (CGL_int s = 0; s < (CGL_int)CGL_utils_array_size(sizes); s++)
+    {
+        CGL_int size = sizes[s];
+        CGL_sizei cells = (CGL_sizei)size * size;
+        CGL_ubyte* bits = (CGL_ubyte*)calloc(cells / 8 + 1, 1);
+        CGL_int* endpoints = (CGL_int*)malloc(sizeof(CGL_int) * 2 * queries);
+        CGL_float* costs = (CGL_float*)malloc(sizeof(CGL_float) * queries);
+        CGL_byte* directions = (CGL_byte*)malloc(cells);
+        if (!bits || !endpoints || !costs || !directions) { printf("out of memory\n"); return 1; }
+        srand(42);
+        for (CGL_sizei i = 0; i < cells; i++) if (rand() % 100 >= 15) bits[i >> 3] |= (CGL_ubyte)(1 << (i & 7));
+        CGL_path_finding_grid* grid = CGL_path_finding_grid_create(size, size, bits);
+        if (!grid) { printf("out of memory\n"); return 1; }
+        for (CGL_int i = 0; i < queries * 2; i++)
+        {
+            CGL_int cell;
+            do cell = (CGL_int)(((CGL_sizei)rand() * RAND_MAX + rand()) % cells); while (!((bits[cell >> 3] >> (cell & 7)) & 1));
+            endpoints[i] = cell;
+        }
+
+        double rates[3]; long long expanded[3];
+        for (CGL_int algorithm = 0; algorithm < 3; algorithm++)
+        {
+            expanded[algorithm] = 0;
+            double start = now_ms();
+            for (CGL_int q = 0; q < queries; q++)
+            {
+                CGL_int a = endpoints[q * 2], b = endpoints[q * 2 + 1];
+                CGL_float cost = -1.0f;
+                CGL_path_finding_grid_find_path(grid, algorithm, a % size, a / size, b % size, b / size, NULL, 0, &cost);
+                expanded[algorithm] += CGL_path_finding_grid_get_expanded_count(grid);
+                if (algorithm == 0) costs[q] = cost;
+                else if (fabsf(cost - costs[q]) > 1e-3f * (1.0f + costs[q])) printf("%s cost differs %f %f\n", names[algorithm], cost, costs[q]);
+            }
+            rates[algorithm] = queries / ((now_ms() - start) * 1e-3);
+        }
+        double start = now_ms();
+        CGL_path_finding_grid_build_flow_field(grid, size / 2, size / 2, directions, NULL);
+        double flow_field = now_ms() - start;
+
+        printf("%6d %15.1f %15.1f %15.1f %15lld %15lld %15lld %12.3f ms\n", size, rates[0], rates[1], rates[2], expanded[0] / queries, expanded[1] / queries, expanded[2] / queries, flow_field);
+        CGL_path_finding_grid_destroy(grid);
+        free(bits); free(endpoints); free(costs); free(directions);
+    }
+    CGL_shutdown();
+    return 0;
+}
@@ -0,0 +1,155 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+
+
+// CGL_path_finding_hpa against flat searches of CGL_path_finding_grid on a map
+// of random rectangular buildings. Shows the time and memory to build the
+// abstract graph, the latency of abstract queries (waypoints only), of fully
+// refined queries and of flat jump point search and a*, with the nodes every
+// query expanded and how much longer the hierarchical paths are. The last part
+// changes a few cells, which only rebuilds their clusters and the neighbours.
+//
+// usage : path_finding_hpa_benchmark [size = 4096] [cluster_size = 32] [queries = 100]
+
+static double now_ms()
+{
+    return (double)CGL_utils_get_time_ns() * 1e-6;
+}
+
+static CGL_int random_int(CGL_int max)
+{
+    return (CGL_int)(((CGL_sizei)rand() * RAND_MAX + rand()) % (CGL_sizei)max);
+}
+
+int main(int argc, char** argv)
+{
+    CGL_init();
+    CGL_int size = argc > 1 ? atoi(argv[1]) : 4096;
+    CGL_int cluster_size = argc > 2 ? atoi(argv[2]) : 32;
+    CGL_int query_count = argc > 3 ? atoi(argv[3]) : 100;
+    CGL_int flat_count = CGL_utils_min(query_count, 10); // flat searches over the whole map take long
+    CGL_sizei cells = (CGL_sizei)size * size;
+    CGL_ubyte* bits = (CGL_ubyte*)malloc(cells / 8 + 1);
+    CGL_int* queries = (CGL_int*)malloc(sizeof(CGL_int) * 4 * query_count);
+    CGL_int* path = (CGL_int*)malloc(sizeof(CGL_int) * size * 8);
+    if (!bits || !queries || !path) { printf("out of memory\n"); return 1; }
+    memset(bits, 0xFF, cells / 8 + 1);
+    srand(42);
+    for (CGL_sizei i = 0; i < cells / 2000; i++) // about a fifth of the map
+    {
+        CGL_int x = random_int(size), y = random_int(size), w = 4 + random_int(36), h = 4 + random_int(36);
+        for (CGL_int by = y; by < CGL_utils_min(y + h, size); by++) for (CGL_int bx = x; bx < CGL_utils_min(x + w, size); bx++)
+        {
+            CGL_sizei cell = (CGL_sizei)by * size + bx;
+            bits[cell >> 3] &= (CGL_ubyte)~(1 << (cell & 7));
+        }
+    }
+    CGL_path_finding_grid* grid = CGL_path_finding_grid_create(size, size, bits);
+    if (!grid) { printf("out of memory\n"); return 1; }
+    for (CGL_int i = 0; i < query_count; i++)
+    {
+        CGL_int* query = queries + i * 4;
+        do { query[0] = random_int(size); query[1] = random_int(size); } while (!CGL_path_finding_grid_is_walkable(grid, query[0], query[1]));
+        do { query[2] = random_int(size); query[3] = random_int(size); } while (!CGL_path_finding_grid_is_walkable(grid, query[2], query[3]));
+    }
+
+    double start = now_ms();
+    CGL_path_finding_hpa* hpa = CGL_path_finding_hpa_create(grid, cluster_size);
+    double build = now_ms() - start;
+    if (!hpa) { printf("out of memory\n"); return 1; }
+    printf("%dx%d map, clusters of %dx%d, %d transitions\n", size, size, cluster_size, cluster_size, CGL_path_finding_hpa_get_node_count(hpa));
+    printf("hpa build %.1f ms, %.2f MB, a flat search keeps %.2f MB of state\n\n", build, CGL_path_finding_hpa_get_memory_usage(hpa) / 1048576.0, (double)(size + 2) * (size + 2) * 16 / 1048576.0);
+
+    printf("%16s %8s %8s %15s %15s %12s\n", "", "queries", "found", "per query", "expanded", "hpa / flat");
+    float* costs = (float*)malloc(sizeof(float) * query_count);
+    if (!costs) { printf("out of memory\n"); return 1; }
+    for (CGL_int test = 0; test < 4; test++)
+    {
+        const char* names[] = { "hpa waypoints", "hpa full path", "flat jps", "flat a*" };
+        CGL_int count = test < 2 ? query_count : flat_count, found = 0;
+        double expanded = 0.0, ratio = 0.0;
+        start = now_ms();
+        for (CGL_int i = 0; i < count; i++)
+        {
+            CGL_int* query = queries + i * 4;
+            CGL_float cost = 0.0f;
+            CGL_int length = -1;
+            if (test == 0) length = CGL_path_finding_hpa_find_path(hpa, query[0], query[1], query[2], query[3], path, size * 8, &cost);
+            else if (test == 1) length = CGL_path_finding_hpa_find_full_path(hpa, query[0], query[1], query[2], query[3], path, size * 8, &cost);
+            else length = CGL_path_finding_grid_find_path(grid, test == 2 ? CGL_PATH_FINDING_GRID_JPS : CGL_PATH_FINDING_GRID_A_STAR, query[0], query[1], query[2], query[3], path, size * 8, &cost);
+            expanded += test < 2 ? CGL_path_finding_hpa_get_expanded_count(hpa) : CGL_path_finding_grid_get_expanded_count(grid);
+            if (length < 0) continue;
+            found++;
+            if (test == 0) costs[i] = cost;
+            else if (test >= 2 && cost > 0.0f) ratio += costs[i] / cost;
+        }
+        double elapsed = now_ms() - start;
+        printf("%16s %8d %8d %12.3f ms %15.0f", names[test], count, found, elapsed / count, expanded / count);
+        if (test >= 2 && found > 0) printf(" %12.4f", ratio / found);
+        printf("\n");
+    }
+
+    // walls appear in a few clusters
+    printf("\n%8s %15s %15s\n", "changes", "rebuilt", "rebuild");
+    for (CGL_int changes = 1; changes <= 64; changes *= 4)
+    {
+        for (CGL_int i = 0; i < changes; i++)
+        {
+            CGL_int x = random_int(size - 8), y = random_int(size - 8);
+            for (CGL_int by = y; by < y + 8; by++) for (CGL_int bx = x; bx < x + 8; bx++) CGL_path_finding_grid_set_walkable(grid, bx, by, CGL_FALSE);
+            CGL_path_finding_hpa_mark_dirty(hpa, x, y, 8, 8);
+        }
+        start = now_ms();
+        CGL_int rebuilt = CGL_path_finding_hpa_rebuild(hpa);
+        printf("%8d %15d %12.3f ms\n", changes, rebuilt, now_ms() - start);
+    }
+
+    CGL_path_finding_hpa_destroy(hpa);
+    CGL_path_finding_grid_destroy(grid);
+    free(bits); free(queries); free(path); free(costs);
+    CGL_shutdown();
+    return 0;
+}
@@ -0,0 +1,161 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+
+// Sorting engine timings against the C library qsort for 10^6 up to max_size
+// elements: the introsort (CGL_sort), the parallel merge sort on the default
+// thread pool, the lsd radix sorts on uint32 and float keys and the key
+// extraction sort of 32 byte records against sorting them with a comparator.
+//
+// usage : sort_benchmark [max_size = 10000000] (10^8 needs ~2 GB of memory)
+
+typedef struct record
+{
+    CGL_float depth;
+    uint32_t id;
+    CGL_float payload[6];
+} record;
+
+static CGL_int compare_u32(const CGL_void* a, const CGL_void* b)
+{
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+static int compare_u32_qsort(const void* a, const void* b)
+{
+    return compare_u32(a, b);
+}
+
+static CGL_int compare_record(const CGL_void* a, const CGL_void* b)
+{
+    CGL_float x = ((const record*)a)->depth, y = ((const record*)b)->depth;
+    return (x > y) - (x < y);
+}
+
+static CGL_float record_depth(const CGL_void* item)
+{
+    return ((const record*)item)->depth;
+}
+
+static double now_ms()
+{
+    return (double)CGL_utils_get_time_ns() * 1e-6;
+}
+
+static int is_sorted_u32(const uint32_t* keys, size_t count)
+{
+    for (size_t i = 1; i < count; i++) if (keys[i - 1] > keys[i]) return 0;
+    return 1;
+}
+
+int main(int argc, char** argv)
+{
+    size_t max_size = argc > 1 ? (size_t)atoll(argv[1]) : 10000000;
+    CGL_thread_pool* pool = CGL_thread_pool_get_default();
+    printf("%zu worker threads\n", pool ? CGL_thread_pool_get_worker_count(pool) : 0);
+    printf("%12s %12s %12s %12s %12s %12s %12s %12s\n", "count", "qsort", "CGL_sort", "parallel", "radix u32", "radix f32", "rec cmp", "rec by_key");
+    for (size_t count = 1000000; count <= max_size; count *= 10)
+    {
+        uint32_t* source = (uint32_t*)malloc(count * sizeof(uint32_t));
+        uint32_t* keys = (uint32_t*)malloc(count * sizeof(uint32_t));
+        CGL_float* floats = (CGL_float*)malloc(count * sizeof(CGL_float));
+        record* records = (record*)malloc(count * sizeof(record));
+        if (!source || !keys || !floats || !records) { printf("out of memory at %zu\n", count); return 1; }
+        for (size_t i = 0; i < count; i++) source[i] = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+        double times[7];
+        int ok = 1;
+
+        memcpy(keys, source, count * sizeof(uint32_t));
+        double start = now_ms();
+        qsort(keys, count, sizeof(uint32_t), compare_u32_qsort);
+        times[0] = now_ms() - start;
+
+        memcpy(keys, source, count * sizeof(uint32_t));
+        start = now_ms();
+        CGL_sort(keys, count, sizeof(uint32_t), compare_u32);
+        times[1] = now_ms() - start;
+        ok &= is_sorted_u32(keys, count);
+
+        memcpy(keys, source, count * sizeof(uint32_t));
+        start = now_ms();
+        CGL_sort_parallel(keys, count, sizeof(uint32_t), compare_u32);
+        times[2] = now_ms() - start;
+        ok &= is_sorted_u32(keys, count);
+
+        memcpy(keys, source, count * sizeof(uint32_t));
+        start = now_ms();
+        CGL_sort_radix_u32(keys, count);
+        times[3] = now_ms() - start;
+        ok &= is_sorted_u32(keys, count);
+
+        for (size_t i = 0; i < count; i++) floats[i] = (CGL_float)((int32_t)source[i]) * 1e-3f;
+        start = now_ms();
+        CGL_sort_radix_f32(floats, count);
+        times[4] = now_ms() - start;
+        for (size_t i = 1; i < count; i++) ok &= floats[i - 1] <= floats[i];
+
+        for (size_t i = 0; i < count; i++) { records[i].depth = floats[(i * 7919) % count]; records[i].id = (uint32_t)i; }
+        start = now_ms();
+        CGL_sort(records, count, sizeof(record), compare_record);
+        times[5] = now_ms() - start;
+
+        for (size_t i = 0; i < count; i++) { records[i].depth = floats[(i * 7919) % count]; records[i].id = (uint32_t)i; }
+        start = now_ms();
+        CGL_sort_by_key_f32(records, count, sizeof(record), record_depth);
+        times[6] = now_ms() - start;
+        for (size_t i = 1; i < count; i++) ok &= records[i - 1].depth <= records[i].depth;
+
+        printf("%12zu", count);
+        for (int i = 0; i < 7; i++) printf(" %9.1f ms", times[i]);
+        printf("%s\n", ok ? "" : "  NOT SORTED");
+        free(source);
+        free(keys);
+        free(floats);
+        free(records);
+    }
+    CGL_shutdown();
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+
+
+// CGL_spatial_hash against CGL_quad_tree on uniformly distributed points in
+// the unit square: the time to build each structure from scratch, and the time
+// of a batch of radius queries sized so that about 20 items fall in each.
+//
+// usage : spatial_hash_benchmark [queries = 10000]
+
+static double now_ms()
+{
+    return (double)CGL_utils_get_time_ns() * 1e-6;
+}
+
+static CGL_float random_float()
+{
+    return (CGL_float)rand() / (CGL_float)RAND_MAX;
+}
+
+int main(int argc, char** argv)
+{
+    CGL_init();
+    CGL_int queries = argc > 1 ? atoi(argv[1]) : 10000;
+    CGL_int counts[] = { 10000, 100000, 1000000 };
+    printf("%d radius queries per size\n", queries);
+    printf("%10s %18s %18s %18s %18s\n", "items", "quad tree build", "hash build", "quad tree query", "hash query");
+    for (int c = 0; c < 3; c++)
+    {
+        CGL_int count = counts[c];
+        CGL_float radius = sqrtf(20.0f / (CGL_PI * (CGL_float)count));
+        CGL_float* positions = (CGL_float*)malloc(sizeof(CGL_float) * 2 * count);
+        CGL_float* query_positions = (CGL_float*)malloc(sizeof(CGL_float) * 2 * queries);
+        CGL_int* items = (CGL_int*)malloc(sizeof(CGL_int) * count);
+        CGL_nd_tree* tree = CGL_quad_tree_create(sizeof(CGL_int), 64, count / 4, count * 4, true);
+        CGL_spatial_hash* hash = CGL_spatial_hash_create(2, radius, count, sizeof(CGL_int), count);
+        if (!positions || !query_positions || !items || !tree || !hash) { printf("out of memory\n"); return 1; }
+        for (CGL_int i = 0; i < count * 2; i++) positions[i] = random_float();
+        for (CGL_int i = 0; i < queries * 2; i++) query_positions[i] = random_float();
+        CGL_int max_depth = (CGL_int)(logf((CGL_float)count / 16.0f) / logf(4.0f)) + 2;
+
+        double start = now_ms();
+        CGL_quad_tree_reset(tree, 0.0f, 0.0f, 1.0f, 1.0f, 16, max_depth, false);
+        for (CGL_int i = 0; i < count; i++) CGL_quad_tree_add(tree, positions[i * 2], positions[i * 2 + 1], &i);
+        double tree_build = now_ms() - start;
+        start = now_ms();
+        CGL_spatial_hash_build(hash, positions, NULL, count);
+        double hash_build = now_ms() - start;
+
+        long long tree_found = 0, hash_found = 0;
+        start = now_ms();
+        for (CGL_int i = 0; i < queries; i++) tree_found += CGL_quad_tree_get_items_in_radius(tree, query_positions[i * 2], query_positions[i * 2 + 1], radius, items, count);
+        double tree_query = now_ms() - start;
+        start = now_ms();
+        for (CGL_int i = 0; i < queries; i++) hash_found += CGL_spatial_hash_get_items_in_radius_2d(hash, query_positions[i * 2], query_positions[i * 2 + 1], radius, items, count);
+        double hash_query = now_ms() - start;
+        if (tree_found != hash_found) printf("results differ %lld %lld\n", tree_found, hash_found);
+
+        printf("%10d %15.3f ms %15.3f ms %15.3f ms %15.3f ms\n", count, tree_build, hash_build, tree_query, hash_query);
+        CGL_nd_tree_destroy(tree);
+        CGL_spatial_hash_destroy(hash);
+        free(positions); free(query_positions); free(items);
+    }
+    CGL_shutdown();
+    return 0;
+}
@@ -0,0 +1,173 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+// Contention microbenchmark for the synchronization primitives. Every thread
+// increments a shared counter inside a critical section guarded by the primitive
+// under test (or with a single atomic add), with an optional amount of private
+// work between the increments to vary the contention.
+//
+// usage : sync_primitives_benchmark [max_threads = 8] [iterations_per_thread = 1000000]
+
+#define MAX_THREADS 64
+
+typedef enum
+{
+    PRIMITIVE_MUTEX,
+    PRIMITIVE_SPINLOCK,
+    PRIMITIVE_RWLOCK_WRITE,
+    PRIMITIVE_RWLOCK_READ,
+    PRIMITIVE_SEMAPHORE,
+    PRIMITIVE_ATOMIC,
+    PRIMITIVE_COUNT
+} primitive_type;
+
+static const char* primitive_names[PRIMITIVE_COUNT] = { "CGL_mutex", "CGL_spinlock", "CGL_rwlock (write)", "CGL_rwlock (read)", "CGL_semaphore", "CGL_atomic_add" };
+
+typedef struct
+{
+    primitive_type type;
+    uint64_t iterations;
+    int private_work;
+} worker_data;
+
+static CGL_mutex* mutex;
+static CGL_spinlock spinlock = CGL_SPINLOCK_INIT;
+static CGL_rwlock* rwlock;
+static CGL_semaphore* semaphore;
+static CGL_barrier* start_barrier;
+static volatile int64_t atomic_counter;
+static int64_t counter;
+
+static void do_private_work(int amount)
+{
+    volatile int sink = 0;
+    for (int i = 0; i < amount; i++) sink += i;
+}
+
+#ifdef CGL_WINDOWS
+static void worker_function(void* argument)
+#else
+static void* worker_function(void* argument)
+#endif
+{
+    worker_data* data = (worker_data*)argument;
+    CGL_barrier_wait(start_barrier);
+    for (uint64_t i = 0; i < data->iterations; i++)
+    {
+        switch (data->type)
+        {
+        case PRIMITIVE_MUTEX: CGL_mutex_lock(mutex, 0); counter++; CGL_mutex_release(mutex); break;
+        case PRIMITIVE_SPINLOCK: CGL_spinlock_lock(&spinlock); counter++; CGL_spinlock_unlock(&spinlock); break;
+        case PRIMITIVE_RWLOCK_WRITE: CGL_rwlock_lock_write(rwlock); counter++; CGL_rwlock_unlock_write(rwlock); break;
+        case PRIMITIVE_RWLOCK_READ: CGL_rwlock_lock_read(rwlock); do_private_work(1); CGL_rwlock_unlock_read(rwlock); break;
+        case PRIMITIVE_SEMAPHORE: CGL_semaphore_acquire(semaphore); counter++; CGL_semaphore_release(semaphore, 1); break;
+        case PRIMITIVE_ATOMIC: CGL_atomic_add_i64(&atomic_counter, 1); break;
+        default: break;
+        }
+        do_private_work(data->private_work);
+    }
+#ifndef CGL_WINDOWS
+    return NULL;
+#endif
+}
+
+// returns nanoseconds per operation
+static double run(primitive_type type, int thread_count, uint64_t iterations, int private_work)
+{
+    static CGL_thread* threads[MAX_THREADS];
+    static worker_data data[MAX_THREADS];
+    counter = 0;
+    atomic_counter = 0;
+    start_barrier = CGL_barrier_create((uint32_t)thread_count + 1);
+    for (int i = 0; i < thread_count; i++)
+    {
+        data[i].type = type;
+        data[i].iterations = iterations;
+        data[i].private_work = private_work;
+        threads[i] = CGL_thread_create();
+        CGL_thread_start(threads[i], worker_function, &data[i]);
+    }
+    uint64_t start = CGL_utils_get_time_ns();
+    CGL_barrier_wait(start_barrier);
+    for (int i = 0; i < thread_count; i++) { CGL_thread_join(threads[i]); CGL_thread_destroy(threads[i]); }
+    double nanoseconds = (double)(CGL_utils_get_time_ns() - start);
+    CGL_barrier_destroy(start_barrier);
+
+    int64_t expected = (type == PRIMITIVE_RWLOCK_READ) ? 0 : (int64_t)(thread_count * iterations);
+    int64_t result = (type == PRIMITIVE_ATOMIC) ? atomic_counter : counter;
+    if (result != expected) printf("error : %s counted %lld instead of %lld\n", primitive_names[type], (long long)result, (long long)expected);
+    return nanoseconds / (double)(thread_count * iterations);
+}
+
+int main(int argc, char** argv)
+{
+    int max_threads = argc > 1 ? atoi(argv[1]) : 8;
+    uint64_t iterations = argc > 2 ? (uint64_t)atoll(argv[2]) : 1000000;
+    max_threads = CGL_utils_clamp(max_threads, 1, MAX_THREADS);
+
+    mutex = CGL_mutex_create(false);
+    rwlock = CGL_rwlock_create();
+    semaphore = CGL_semaphore_create(1);
+
+    static const int private_work[] = { 0, 50 };
+    for (int w = 0; w < 2; w++)
+    {
+        printf("\n%s contention (private work = %d)\n", private_work[w] == 0 ? "high" : "low", private_work[w]);
+        printf("%-20s", "ns/op");
+        for (int thread_count = 1; thread_count <= max_threads; thread_count *= 2) printf(" | %4d threads", thread_count);
+        printf("\n");
+        for (int type = 0; type < PRIMITIVE_COUNT; type++)
+        {
+            printf("%-20s", primitive_names[type]);
+            for (int thread_count = 1; thread_count <= max_threads; thread_count *= 2)
+                printf(" | %12.2f", run((primitive_type)type, thread_count, iterations / (uint64_t)thread_count, private_work[w]));
+            printf("\n");
+        }
+    }
+
+    CGL_semaphore_destroy(semaphore);
+    CGL_rwlock_destroy(rwlock);
+    CGL_mutex_destroy(mutex);
+    return 0;
+}
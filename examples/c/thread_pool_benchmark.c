@@ -0,0 +1,108 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+// Runs a particle integration step (gravity, drag and bouncing off the floor) over
+// one million particles with CGL_thread_pool_parallel_for on 1 to N worker threads.
+//
+// usage : thread_pool_benchmark [max_threads = hardware concurrency] [particle_count = 1000000]
+
+#define STEP_COUNT 50
+
+typedef struct
+{
+    CGL_vec3* positions;
+    CGL_vec3* velocities;
+    CGL_float delta_time;
+} particle_data;
+
+static void integrate_particles(CGL_sizei begin, CGL_sizei end, void* user_data)
+{
+    particle_data* data = (particle_data*)user_data;
+    const CGL_float dt = data->delta_time, drag = 1.0f - 0.1f * dt;
+    for (CGL_sizei i = begin; i < end; i++)
+    {
+        CGL_vec3* position = &data->positions[i];
+        CGL_vec3* velocity = &data->velocities[i];
+        velocity->y -= 9.8f * dt;
+        velocity->x *= drag; velocity->y *= drag; velocity->z *= drag;
+        position->x += velocity->x * dt;
+        position->y += velocity->y * dt;
+        position->z += velocity->z * dt;
+        if (position->y < 0.0f) { position->y = -position->y; velocity->y = -velocity->y * 0.8f; }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    CGL_sizei max_threads = argc > 1 ? (CGL_sizei)atoi(argv[1]) : CGL_thread_get_hardware_concurrency();
+    CGL_sizei particle_count = argc > 2 ? (CGL_sizei)atoll(argv[2]) : 1000000;
+
+    particle_data data;
+    data.positions = (CGL_vec3*)CGL_malloc(sizeof(CGL_vec3) * particle_count);
+    data.velocities = (CGL_vec3*)CGL_malloc(sizeof(CGL_vec3) * particle_count);
+    data.delta_time = 1.0f / 60.0f;
+
+    double single_thread_time = 0.0;
+    printf("threads | ms per step | speedup\n");
+    for (CGL_sizei thread_count = 1; thread_count <= max_threads; thread_count++)
+    {
+        for (CGL_sizei i = 0; i < particle_count; i++)
+        {
+            data.positions[i] = CGL_vec3_init(CGL_utils_random_float(), CGL_utils_random_float() * 10.0f, CGL_utils_random_float());
+            data.velocities[i] = CGL_vec3_init(CGL_utils_random_float() - 0.5f, CGL_utils_random_float(), CGL_utils_random_float() - 0.5f);
+        }
+        // the calling thread takes part in the work so the pool needs one worker less
+        CGL_thread_pool* pool = thread_count > 1 ? CGL_thread_pool_create(thread_count - 1) : NULL;
+        uint64_t start = CGL_utils_get_time_ns();
+        for (int step = 0; step < STEP_COUNT; step++)
+            CGL_thread_pool_parallel_for(pool, 0, particle_count, 16384, integrate_particles, &data);
+        double step_time = (CGL_utils_get_time_ns() - start) / 1e6 / STEP_COUNT;
+        if (thread_count == 1) single_thread_time = step_time;
+        printf("%7zu | %11.3f | %6.2fx\n", thread_count, step_time, single_thread_time / step_time);
+        if (pool) CGL_thread_pool_destroy(pool);
+    }
+
+    CGL_free(data.positions);
+    CGL_free(data.velocities);
+    return 0;
+}
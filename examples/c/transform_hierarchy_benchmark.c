@@ -0,0 +1,127 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+
+
+// World matrices of a scene graph of transforms with four children per node.
+// CGL_transform_update walks up to the root for every transform it is called
+// on, so updating a whole scene through it costs nodes * depth matrix products.
+// CGL_transform_hierarchy does one pass over a flat parent before child array
+// and only touches the nodes that moved and their descendants. Both are timed
+// with every node animated and with one in a hundred animated.
+//
+// usage : transform_hierarchy_benchmark [nodes = 100000] [frames = 100]
+
+static double now_ms()
+{
+    return (double)CGL_utils_get_time_ns() * 1e-6;
+}
+
+static CGL_vec3 node_rotation(size_t node, int frame)
+{
+    CGL_float angle = (CGL_float)frame * 0.01f + (CGL_float)node * 0.001f;
+    return CGL_vec3_init(angle, angle * 0.5f, angle * 0.25f);
+}
+
+static double run_recursive(size_t count, int frames, size_t animated_every)
+{
+    CGL_transform* transforms = (CGL_transform*)malloc(count * sizeof(CGL_transform));
+    if (!transforms) return -1.0;
+    for (size_t i = 0; i < count; i++)
+    {
+        transforms[i] = CGL_transform_create_empty();
+        CGL_transform_set_position(&transforms[i], CGL_vec3_init(1.0f, 0.0f, 0.0f));
+        if (i > 0) CGL_transform_set_parent(&transforms[i], &transforms[(i - 1) / 4]);
+    }
+    double start = now_ms();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        for (size_t i = 0; i < count; i += animated_every) CGL_transform_set_rotation(&transforms[i], node_rotation(i, frame));
+        for (size_t i = 0; i < count; i++) CGL_transform_update(&transforms[i]);
+    }
+    double elapsed = now_ms() - start;
+    free(transforms);
+    return elapsed;
+}
+
+static double run_hierarchy(size_t count, int frames, size_t animated_every, CGL_bool multithreaded)
+{
+    CGL_transform_hierarchy* hierarchy = CGL_transform_hierarchy_create(count);
+    if (!hierarchy) return -1.0;
+    CGL_transform_hierarchy_set_multithreaded(hierarchy, multithreaded);
+    for (size_t i = 0; i < count; i++) CGL_transform_hierarchy_add(hierarchy, i > 0 ? (CGL_int)((i - 1) / 4) : CGL_TRANSFORM_HIERARCHY_NO_PARENT, CGL_vec3_init(1.0f, 0.0f, 0.0f), CGL_vec3_init(0.0f, 0.0f, 0.0f), CGL_vec3_init(1.0f, 1.0f, 1.0f));
+    CGL_transform_hierarchy_update(hierarchy);
+    double start = now_ms();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        for (size_t i = 0; i < count; i += animated_every) CGL_transform_hierarchy_set_rotation(hierarchy, (CGL_int)i, node_rotation(i, frame));
+        CGL_transform_hierarchy_update(hierarchy);
+    }
+    double elapsed = now_ms() - start;
+    CGL_transform_hierarchy_destroy(hierarchy);
+    return elapsed;
+}
+
+int main(int argc, char** argv)
+{
+    size_t count = argc > 1 ? (size_t)atoll(argv[1]) : 100000;
+    int frames = argc > 2 ? atoi(argv[2]) : 100;
+    CGL_thread_pool* pool = CGL_thread_pool_get_default();
+    printf("%zu nodes, %d frames, %zu worker threads\n", count, frames, pool ? CGL_thread_pool_get_worker_count(pool) : 0);
+    size_t animated_every[] = { 1, 100 };
+    for (int i = 0; i < 2; i++)
+    {
+        double recursive = run_recursive(count, frames, animated_every[i]);
+        double single = run_hierarchy(count, frames, animated_every[i], false);
+        double parallel = run_hierarchy(count, frames, animated_every[i], true);
+        if (recursive < 0.0 || single < 0.0 || parallel < 0.0) { printf("out of memory\n"); return 1; }
+        printf("every %zu nodes animated\n", animated_every[i]);
+        printf("    %-36s %8.3f ms per frame\n", "CGL_transform_update", recursive / frames);
+        printf("    %-36s %8.3f ms per frame\n", "CGL_transform_hierarchy", single / frames);
+        printf("    %-36s %8.3f ms per frame\n", "CGL_transform_hierarchy (threads)", parallel / frames);
+    }
+    CGL_shutdown();
+    return 0;
+}
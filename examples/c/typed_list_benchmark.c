@@ -0,0 +1,238 @@
+/*
+MIT License
+
+Copyright (c) 2023 Jaysmito Mukherjee (jaysmito101@gmail.com)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#define CGL_EXCLUDE_WINDOW_API
+#define CGL_EXCLUDE_GRAPHICS_API
+#define CGL_EXCLUDE_NETWORKING
+#define CGL_EXCLUDE_AUDIO
+#define CGL_EXCLUDE_TEXT_RENDER
+#define CGL_EXCLUDE_BLOOM
+#define CGL_EXCLUDE_NODE_EDITOR
+#define CGL_EXCLUDE_PHONG_RENDERER
+#define CGL_EXCLUDE_POST_PROCESSOR
+#define CGL_EXCLUDE_RAY_CASTER
+#define CGL_EXCLUDE_SKY_RENDERER
+#define CGL_EXCLUDE_TILEMAP_RENDERER
+#define CGL_EXCLUDE_TRAIL_RENDERER
+#define CGL_EXCLUDE_WIDGETS
+#define CGL_EXCLUDE_SQUARE_MARCHER
+#define CGL_IMPLEMENTATION
+#include "cgl.h"
+
+
+
+
+// Typed lists (CGL_DECLARE_LIST) against the untyped CGL_list on the work the
+// obj loader does per face: look up position/uv/normal by index, build a
+// CGL_mesh_vertex sized vertex and push it along with its indices. Also times
+// plain pushes, bulk appends, sorting and lookups (CGL_list_find against a
+// binary search of the sorted typed list).
+//
+// usage : typed_list_benchmark [faces = 500000]
+
+// same layout as CGL_mesh_vertex, which needs the graphics api
+typedef struct vertex
+{
+    CGL_vec4 position;
+    CGL_vec4 normal;
+    CGL_vec4 texture_coordinates;
+    CGL_vec4 bone_wieghts;
+    CGL_ivec4 bone_ids;
+} vertex;
+
+CGL_DECLARE_LIST_NAMED(vertex_list, vertex)
+CGL_DECLARE_LIST_NAMED(vec4_list, CGL_vec4)
+
+static double now_ms()
+{
+    return (double)CGL_utils_get_time_ns() * 1e-6;
+}
+
+static CGL_int compare_u32(const uint32_t* a, const uint32_t* b)
+{
+    return (*a > *b) - (*a < *b);
+}
+
+static CGL_int compare_u32_void(const CGL_void* a, const CGL_void* b)
+{
+    return compare_u32((const uint32_t*)a, (const uint32_t*)b);
+}
+
+// the faces of a grid of quads, three 1 based v/vt/vn triples per face like the obj loader sees them
+static uint32_t* make_faces(int faces, int attributes)
+{
+    uint32_t* face_data = (uint32_t*)malloc(sizeof(uint32_t) * 9 * faces);
+    for (int i = 0; i < faces * 9; i++) face_data[i] = (uint32_t)(rand() % attributes) + 1;
+    return face_data;
+}
+
+static double obj_untyped(const uint32_t* faces, int face_count, int attributes, size_t* checksum)
+{
+    double start = now_ms();
+    CGL_list* positions = CGL_list_create(sizeof(float) * 4, 1000);
+    CGL_list* normals = CGL_list_create(sizeof(float) * 4, 1000);
+    CGL_list* uvs = CGL_list_create(sizeof(float) * 4, 1000);
+    CGL_list* vertices = CGL_list_create(sizeof(vertex), 1000);
+    CGL_list* indices = CGL_list_create(sizeof(uint32_t), 1000);
+    float item[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    for (int i = 0; i < attributes; i++)
+    {
+        item[0] = (float)i;
+        CGL_list_push(positions, item);
+        CGL_list_push(normals, item);
+        CGL_list_push(uvs, item);
+    }
+    uint32_t index = 0;
+    for (int f = 0; f < face_count; f++)
+    {
+        vertex current = { 0 };
+        for (int i = 0; i < 3; i++)
+        {
+            const uint32_t* v = faces + f * 9 + i * 3;
+            if (!CGL_list_get(positions, v[0] - 1, &current.position)) current.position = CGL_vec4_init(0.0f, 0.0f, 0.0f, 0.0f);
+            if (!CGL_list_get(uvs, v[1] - 1, &current.texture_coordinates)) current.texture_coordinates = CGL_vec4_init(0.0f, 0.0f, 0.0f, 0.0f);
+            if (!CGL_list_get(normals, v[2] - 1, &current.normal)) current.normal = CGL_vec4_init(0.0f, 0.0f, 0.0f, 0.0f);
+            CGL_list_push(vertices, &current);
+        }
+        CGL_list_push(indices, &index); index++;
+        CGL_list_push(indices, &index); index++;
+        CGL_list_push(indices, &index); index++;
+    }
+    *checksum = CGL_list_get_size(vertices) + CGL_list_get_size(indices);
+    CGL_list_destroy(positions);
+    CGL_list_destroy(normals);
+    CGL_list_destroy(uvs);
+    CGL_list_destroy(vertices);
+    CGL_list_destroy(indices);
+    return now_ms() - start;
+}
+
+static double obj_typed(const uint32_t* faces, int face_count, int attributes, size_t* checksum)
+{
+    double start = now_ms();
+    vec4_list* positions = vec4_list_create(1000);
+    vec4_list* normals = vec4_list_create(1000);
+    vec4_list* uvs = vec4_list_create(1000);
+    vertex_list* vertices = vertex_list_create(1000);
+    CGL_list_uint32_t* indices = CGL_list_uint32_t_create(1000);
+    for (int i = 0; i < attributes; i++)
+    {
+        CGL_vec4 item = CGL_vec4_init((float)i, 0.0f, 0.0f, 1.0f);
+        vec4_list_push(positions, item);
+        vec4_list_push(normals, item);
+        vec4_list_push(uvs, item);
+    }
+    CGL_vec4 zero = CGL_vec4_init(0.0f, 0.0f, 0.0f, 0.0f);
+    uint32_t index = 0;
+    for (int f = 0; f < face_count; f++)
+    {
+        vertex current = { 0 };
+        for (int i = 0; i < 3; i++)
+        {
+            const uint32_t* v = faces + f * 9 + i * 3;
+            CGL_vec4* item = vec4_list_at(positions, (CGL_sizei)v[0] - 1);
+            current.position = item ? *item : zero;
+            item = vec4_list_at(uvs, (CGL_sizei)v[1] - 1);
+            current.texture_coordinates = item ? *item : zero;
+            item = vec4_list_at(normals, (CGL_sizei)v[2] - 1);
+            current.normal = item ? *item : zero;
+            vertex_list_push(vertices, current);
+        }
+        uint32_t face_indices[3] = { index, index + 1, index + 2 };
+        CGL_list_uint32_t_push_n(indices, face_indices, 3); index += 3;
+    }
+    *checksum = vertices->size + indices->size;
+    vec4_list_destroy(positions);
+    vec4_list_destroy(normals);
+    vec4_list_destroy(uvs);
+    vertex_list_destroy(vertices);
+    CGL_list_uint32_t_destroy(indices);
+    return now_ms() - start;
+}
+
+int main(int argc, char** argv)
+{
+    int faces = argc > 1 ? atoi(argv[1]) : 500000;
+    int attributes = faces / 2 + 1;
+    srand(42);
+
+    uint32_t* face_data = make_faces(faces, attributes);
+    size_t untyped_checksum = 0, typed_checksum = 0;
+    double untyped = obj_untyped(face_data, faces, attributes, &untyped_checksum);
+    double typed = obj_typed(face_data, faces, attributes, &typed_checksum);
+    printf("obj loader lists, %d faces\n", faces);
+    printf("  CGL_list           %10.2f ms\n", untyped);
+    printf("  typed list         %10.2f ms  (%.2fx)%s\n", typed, untyped / typed, untyped_checksum == typed_checksum ? "" : "  MISMATCH");
+    free(face_data);
+
+    int count = faces * 3;
+    uint32_t* values = (uint32_t*)malloc(sizeof(uint32_t) * count);
+    for (int i = 0; i < count; i++) values[i] = (uint32_t)rand() * 7919u;
+
+    double start = now_ms();
+    CGL_list* untyped_list = CGL_list_create(sizeof(uint32_t), 16);
+    for (int i = 0; i < count; i++) CGL_list_push(untyped_list, &values[i]);
+    double untyped_push = now_ms() - start;
+    start = now_ms();
+    CGL_list_uint32_t* typed_list = CGL_list_uint32_t_create(16);
+    for (int i = 0; i < count; i++) CGL_list_uint32_t_push(typed_list, values[i]);
+    double typed_push = now_ms() - start;
+    start = now_ms();
+    CGL_list_uint32_t* bulk_list = CGL_list_uint32_t_create(16);
+    for (int i = 0; i < count; i += 4096) CGL_list_uint32_t_push_n(bulk_list, values + i, CGL_utils_min(4096, count - i));
+    double bulk_push = now_ms() - start;
+    printf("push %d uint32\n", count);
+    printf("  CGL_list_push      %10.2f ms\n", untyped_push);
+    printf("  typed push         %10.2f ms  (%.2fx)\n", typed_push, untyped_push / typed_push);
+    printf("  typed push_n       %10.2f ms  (%.2fx)\n", bulk_push, untyped_push / bulk_push);
+
+    start = now_ms();
+    CGL_utils_quick_sort(CGL_list_get(untyped_list, 0, NULL), count, sizeof(uint32_t), compare_u32_void);
+    double untyped_sort = now_ms() - start;
+    start = now_ms();
+    CGL_list_uint32_t_sort(typed_list, compare_u32);
+    double typed_sort = now_ms() - start;
+    printf("sort %d uint32\n", count);
+    printf("  CGL_utils_quick_sort %8.2f ms\n", untyped_sort);
+    printf("  typed sort         %10.2f ms  (%.2fx)\n", typed_sort, untyped_sort / typed_sort);
+
+    int lookups = 200;
+    size_t found = 0;
+    start = now_ms();
+    for (int i = 0; i < lookups; i++) found += CGL_list_find(untyped_list, &values[rand() % count]) != (CGL_sizei)UINT64_MAX;
+    double untyped_find = (now_ms() - start) / lookups;
+    start = now_ms();
+    for (int i = 0; i < lookups * 1000; i++) found += CGL_list_uint32_t_binary_search(typed_list, &values[rand() % count], compare_u32) != CGL_LIST_NOT_FOUND;
+    double typed_find = (now_ms() - start) / (lookups * 1000);
+    printf("lookup in %d uint32 (%zu found)\n", count, found);
+    printf("  CGL_list_find      %10.4f ms\n", untyped_find);
+    printf("  binary_search      %10.6f ms  (%.0fx)\n", typed_find, untyped_find / typed_find);
+
+    CGL_list_destroy(untyped_list);
+    CGL_list_uint32_t_destroy(typed_list);
+    CGL_list_uint32_t_destroy(bulk_list);
+    free(values);
+    return 0;
+}